@@ -0,0 +1,186 @@
+//Regression benchmarks for the public API, on operands of 10 to 10^7 decimal
+//digits. Every benchmark reports the size it ran at as its complexity N, so
+//--benchmark_format=json output can be compared run against run.
+#include "bigint.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <map>
+#include <random>
+
+using namespace std;
+using namespace bigint;
+
+//A random number of exactly d digits, shared between benchmarks of one size
+static const BigInt &random_number(size_t d, unsigned seed = 0){
+	static map<pair<size_t, unsigned>, BigInt> cache;
+	BigInt &x = cache[{d, seed}];
+	if(Null(x)){
+		mt19937_64 rng(d * 31 + seed);
+		string s(d, '0');
+		for (char &c : s)
+			c = '0' + rng() % 10;
+		s[0] = '1' + rng() % 9;
+		x = BigInt(s);
+	}
+	return x;
+}
+
+//Largest n whose value f(n) has at most d digits, for digits = log10 f(n)
+//increasing in n
+template<class Digits>
+static unsigned long long index_for_digits(size_t d, Digits digits){
+	unsigned long long lo = 1, hi = 2;
+	while(digits(hi) < d)
+		hi *= 2;
+	while(lo + 1 < hi){
+		unsigned long long mid = lo + (hi - lo) / 2;
+		(digits(mid) < d ? lo : hi) = mid;
+	}
+	return lo;
+}
+
+static void Sizes(benchmark::internal::Benchmark *b){
+	b->RangeMultiplier(10)->Range(10, 10000000)->Unit(benchmark::kMicrosecond);
+}
+
+static void BM_Add(benchmark::State &state){
+	size_t d = state.range(0);
+	const BigInt &a = random_number(d), &b = random_number(d, 1);
+	BigInt r;
+	for (auto _ : state){
+		add(r, a, b);
+		benchmark::DoNotOptimize(r);
+	}
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Add)->Apply(Sizes);
+
+static void BM_Mul(benchmark::State &state){
+	size_t d = state.range(0);
+	const BigInt &a = random_number(d), &b = random_number(d, 1);
+	BigInt r;
+	for (auto _ : state){
+		mul(r, a, b);
+		benchmark::DoNotOptimize(r);
+	}
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Mul)->Apply(Sizes);
+
+//A 2d digit number by a d digit one
+static void BM_Div(benchmark::State &state){
+	size_t d = state.range(0);
+	const BigInt &a = random_number(2 * d), &b = random_number(d, 1);
+	BigInt q, r;
+	for (auto _ : state){
+		divmod(q, r, a, b);
+		benchmark::DoNotOptimize(q);
+	}
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Div)->Apply(Sizes);
+
+//The d digit root of a 2d digit number
+static void BM_Sqrt(benchmark::State &state){
+	size_t d = state.range(0);
+	const BigInt &a = random_number(2 * d);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(sqrt(a));
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Sqrt)->Apply(Sizes);
+
+//3^e with d digits
+static void BM_Pow(benchmark::State &state){
+	size_t d = state.range(0);
+	BigInt base(3), e((unsigned long long)(d / log10(3.0)));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(pow(base, e));
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Pow)->Apply(Sizes);
+
+static void BM_Factorial(benchmark::State &state){
+	size_t d = state.range(0);
+	unsigned long long n = index_for_digits(d, [](unsigned long long n){
+		return lgamma((double)n + 1) / log(10.0);
+	});
+	for (auto _ : state)
+		benchmark::DoNotOptimize(Factorial(n));
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Factorial)->Apply(Sizes);
+
+static void BM_NthFibonacci(benchmark::State &state){
+	size_t d = state.range(0);
+	unsigned long long n = d / log10((1 + sqrt(5.0)) / 2);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(NthFibonacci(n));
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_NthFibonacci)->Apply(Sizes);
+
+static void BM_NthCatalan(benchmark::State &state){
+	size_t d = state.range(0);
+	unsigned long long n = d / log10(4.0);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(NthCatalan(n));
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_NthCatalan)->Apply(Sizes);
+
+//Two d digit numbers; the gcd stops at 10^6 digits, where one call already
+//takes seconds
+static void GcdSizes(benchmark::internal::Benchmark *b){
+	b->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
+}
+
+static void BM_Gcd(benchmark::State &state){
+	size_t d = state.range(0);
+	const BigInt &a = random_number(d), &b = random_number(d, 1);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(gcd(a, b));
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Gcd)->Apply(GcdSizes);
+
+static void BM_Xgcd(benchmark::State &state){
+	size_t d = state.range(0);
+	const BigInt &a = random_number(d), &b = random_number(d, 1);
+	BigInt g, s, t;
+	for (auto _ : state){
+		xgcd(g, s, t, a, b);
+		benchmark::DoNotOptimize(s);
+	}
+	state.SetComplexityN(d);
+}
+BENCHMARK(BM_Xgcd)->Apply(GcdSizes);
+
+static void BM_Parse(benchmark::State &state){
+	size_t d = state.range(0);
+	string s(d, ' ');
+	to_chars(&s[0], &s[0] + d, random_number(d));
+	BigInt x;
+	for (auto _ : state){
+		from_chars(s.data(), s.data() + d, x);
+		benchmark::DoNotOptimize(x);
+	}
+	state.SetComplexityN(d);
+	state.SetBytesProcessed(state.iterations() * d);
+}
+BENCHMARK(BM_Parse)->Apply(Sizes);
+
+static void BM_Print(benchmark::State &state){
+	size_t d = state.range(0);
+	const BigInt &a = random_number(d);
+	string s(d, ' ');
+	for (auto _ : state)
+		benchmark::DoNotOptimize(to_chars(&s[0], &s[0] + d, a));
+	state.SetComplexityN(d);
+	state.SetBytesProcessed(state.iterations() * d);
+}
+BENCHMARK(BM_Print)->Apply(Sizes);
+
+BENCHMARK_MAIN();
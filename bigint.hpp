@@ -0,0 +1,5143 @@
+#ifndef BIGINT_HPP
+#define BIGINT_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+//Everything lives in namespace bigint, which sees all of std the way the
+//library was written; the operators are found by argument-dependent lookup
+namespace bigint{
+
+using namespace std;
+
+//A limb is one base 2^64 "digit"; a dlimb holds the product of two limbs.
+typedef uint64_t limb_t;
+typedef unsigned __int128 dlimb_t;
+
+			/* * * * Vector kernels * * * */
+
+//Equal length add, subtract, compare and top-zero scan, as plain loops and as
+//AVX2, AVX-512 and NEON versions; LIMB_KERNELS holds the best set for the CPU
+//the program runs on. A vector add computes all lane sums at once and then
+//resolves the carries of a block from two bitmasks, the lanes that overflowed
+//and the lanes that are all ones, the way a carry-lookahead adder would:
+//adding the shifted carries to the all-ones mask ripples each carry through
+//the run of all-ones lanes above it, and xor with that mask leaves exactly the
+//lanes that must be incremented. Subtraction does the same with borrows and
+//all-zero lanes.
+
+//r[0..n) = a[0..n) + b[0..n) + c, returns the carry out
+inline limb_t limbs_add_n_scalar(limb_t *r, const limb_t *a, const limb_t *b, size_t n, limb_t c){
+	for (size_t i = 0; i < n; i++){
+		dlimb_t s = (dlimb_t)a[i] + b[i] + c;
+		r[i] = (limb_t)s;
+		c = (limb_t)(s >> 64);
+	}
+	return c;
+}
+//r[0..n) = a[0..n) - b[0..n) - c, returns the borrow out
+inline limb_t limbs_sub_n_scalar(limb_t *r, const limb_t *a, const limb_t *b, size_t n, limb_t c){
+	for (size_t i = 0; i < n; i++){
+		dlimb_t d = (dlimb_t)a[i] - b[i] - c;
+		r[i] = (limb_t)d;
+		c = (limb_t)(d >> 64) & 1;
+	}
+	return c;
+}
+//Sign of a[0..n) - b[0..n)
+inline int limbs_cmp_n_scalar(const limb_t *a, const limb_t *b, size_t n){
+	while(n--)
+		if(a[n] != b[n])
+			return a[n] < b[n] ? -1 : 1;
+	return 0;
+}
+//Number of limbs of a[0..n) once leading zeros are dropped
+inline size_t limbs_normalized_size_scalar(const limb_t *a, size_t n){
+	while(n && !a[n - 1])
+		n--;
+	return n;
+}
+
+#if defined(__x86_64__)
+//Lanes of a block that receive a carry (or borrow): gen marks the lanes that
+//produced one, prop the lanes that pass an incoming one on; lanes is the
+//block width and c the carry into the block, which is replaced by the carry out
+inline unsigned carry_lookahead(unsigned gen, unsigned prop, unsigned lanes, limb_t &c){
+	unsigned t = ((gen << 1) | (unsigned)c) + prop;
+	c = t >> lanes;
+	return (t ^ prop) & ((1u << lanes) - 1);
+}
+
+//The unsigned 64-bit compares AVX2 lacks, through a sign flip
+__attribute__((target("avx2")))
+inline __m256i avx2_less(__m256i x, __m256i y){
+	const __m256i sign = _mm256_set1_epi64x((long long)1 << 63);
+	return _mm256_cmpgt_epi64(_mm256_xor_si256(y, sign), _mm256_xor_si256(x, sign));
+}
+__attribute__((target("avx2")))
+inline unsigned avx2_mask(__m256i v){
+	return _mm256_movemask_pd(_mm256_castsi256_pd(v));
+}
+//All-ones lanes of a 4-bit mask
+__attribute__((target("avx2")))
+inline __m256i avx2_lanes(unsigned m){
+	const __m256i bit = _mm256_setr_epi64x(1, 2, 4, 8);
+	return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(m), bit), bit);
+}
+
+__attribute__((target("avx2")))
+inline limb_t limbs_add_n_avx2(limb_t *r, const limb_t *a, const limb_t *b, size_t n, limb_t c){
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4){
+		__m256i x = _mm256_loadu_si256((const __m256i *)(a + i)), y = _mm256_loadu_si256((const __m256i *)(b + i));
+		__m256i s = _mm256_add_epi64(x, y);
+		unsigned gen = avx2_mask(avx2_less(s, x)), prop = avx2_mask(_mm256_cmpeq_epi64(s, _mm256_set1_epi64x(-1)));
+		s = _mm256_sub_epi64(s, avx2_lanes(carry_lookahead(gen, prop, 4, c)));
+		_mm256_storeu_si256((__m256i *)(r + i), s);
+	}
+	return limbs_add_n_scalar(r + i, a + i, b + i, n - i, c);
+}
+__attribute__((target("avx2")))
+inline limb_t limbs_sub_n_avx2(limb_t *r, const limb_t *a, const limb_t *b, size_t n, limb_t c){
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4){
+		__m256i x = _mm256_loadu_si256((const __m256i *)(a + i)), y = _mm256_loadu_si256((const __m256i *)(b + i));
+		__m256i d = _mm256_sub_epi64(x, y);
+		unsigned gen = avx2_mask(avx2_less(x, y)), prop = avx2_mask(_mm256_cmpeq_epi64(d, _mm256_setzero_si256()));
+		d = _mm256_add_epi64(d, avx2_lanes(carry_lookahead(gen, prop, 4, c)));
+		_mm256_storeu_si256((__m256i *)(r + i), d);
+	}
+	return limbs_sub_n_scalar(r + i, a + i, b + i, n - i, c);
+}
+__attribute__((target("avx2")))
+inline int limbs_cmp_n_avx2(const limb_t *a, const limb_t *b, size_t n){
+	for (; n >= 4; n -= 4){
+		__m256i x = _mm256_loadu_si256((const __m256i *)(a + n - 4)), y = _mm256_loadu_si256((const __m256i *)(b + n - 4));
+		unsigned ne = avx2_mask(_mm256_cmpeq_epi64(x, y)) ^ 15;
+		if(ne){
+			size_t i = n - 4 + 31 - __builtin_clz(ne);
+			return a[i] < b[i] ? -1 : 1;
+		}
+	}
+	return limbs_cmp_n_scalar(a, b, n);
+}
+__attribute__((target("avx2")))
+inline size_t limbs_normalized_size_avx2(const limb_t *a, size_t n){
+	for (; n >= 4; n -= 4){
+		__m256i x = _mm256_loadu_si256((const __m256i *)(a + n - 4));
+		if(!_mm256_testz_si256(x, x))
+			return n - 4 + 32 - __builtin_clz(avx2_mask(_mm256_cmpeq_epi64(x, _mm256_setzero_si256())) ^ 15);
+	}
+	return limbs_normalized_size_scalar(a, n);
+}
+
+__attribute__((target("avx512f")))
+inline limb_t limbs_add_n_avx512(limb_t *r, const limb_t *a, const limb_t *b, size_t n, limb_t c){
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8){
+		__m512i x = _mm512_loadu_si512(a + i), y = _mm512_loadu_si512(b + i);
+		__m512i s = _mm512_add_epi64(x, y);
+		unsigned gen = _mm512_cmplt_epu64_mask(s, x), prop = _mm512_cmpeq_epi64_mask(s, _mm512_set1_epi64(-1));
+		s = _mm512_mask_sub_epi64(s, carry_lookahead(gen, prop, 8, c), s, _mm512_set1_epi64(-1));
+		_mm512_storeu_si512(r + i, s);
+	}
+	return limbs_add_n_scalar(r + i, a + i, b + i, n - i, c);
+}
+__attribute__((target("avx512f")))
+inline limb_t limbs_sub_n_avx512(limb_t *r, const limb_t *a, const limb_t *b, size_t n, limb_t c){
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8){
+		__m512i x = _mm512_loadu_si512(a + i), y = _mm512_loadu_si512(b + i);
+		__m512i d = _mm512_sub_epi64(x, y);
+		unsigned gen = _mm512_cmplt_epu64_mask(x, y), prop = _mm512_cmpeq_epi64_mask(d, _mm512_setzero_si512());
+		d = _mm512_mask_add_epi64(d, carry_lookahead(gen, prop, 8, c), d, _mm512_set1_epi64(-1));
+		_mm512_storeu_si512(r + i, d);
+	}
+	return limbs_sub_n_scalar(r + i, a + i, b + i, n - i, c);
+}
+__attribute__((target("avx512f")))
+inline int limbs_cmp_n_avx512(const limb_t *a, const limb_t *b, size_t n){
+	for (; n >= 8; n -= 8){
+		unsigned ne = _mm512_cmpneq_epi64_mask(_mm512_loadu_si512(a + n - 8), _mm512_loadu_si512(b + n - 8));
+		if(ne){
+			size_t i = n - 8 + 31 - __builtin_clz(ne);
+			return a[i] < b[i] ? -1 : 1;
+		}
+	}
+	return limbs_cmp_n_scalar(a, b, n);
+}
+__attribute__((target("avx512f")))
+inline size_t limbs_normalized_size_avx512(const limb_t *a, size_t n){
+	for (; n >= 8; n -= 8){
+		unsigned nz = _mm512_test_epi64_mask(_mm512_loadu_si512(a + n - 8), _mm512_loadu_si512(a + n - 8));
+		if(nz)
+			return n - 8 + 32 - __builtin_clz(nz);
+	}
+	return limbs_normalized_size_scalar(a, n);
+}
+#endif
+
+#if defined(__aarch64__)
+//NEON has no wide carry chain to speed up, so add and subtract stay scalar
+//there; the scans compare two limbs per step
+inline int limbs_cmp_n_neon(const limb_t *a, const limb_t *b, size_t n){
+	for (; n >= 2; n -= 2){
+		uint64x2_t eq = vceqq_u64(vld1q_u64(a + n - 2), vld1q_u64(b + n - 2));
+		if(vgetq_lane_u64(eq, 0) & vgetq_lane_u64(eq, 1))
+			continue;
+		size_t i = vgetq_lane_u64(eq, 1) ? n - 2 : n - 1;
+		return a[i] < b[i] ? -1 : 1;
+	}
+	return limbs_cmp_n_scalar(a, b, n);
+}
+inline size_t limbs_normalized_size_neon(const limb_t *a, size_t n){
+	for (; n >= 2; n -= 2){
+		uint64x2_t x = vld1q_u64(a + n - 2);
+		if(vmaxvq_u32(vreinterpretq_u32_u64(x)))
+			return vgetq_lane_u64(x, 1) ? n : n - 1;
+	}
+	return limbs_normalized_size_scalar(a, n);
+}
+#endif
+
+struct LimbKernels{
+	const char *name;
+	limb_t (*add_n)(limb_t *, const limb_t *, const limb_t *, size_t, limb_t);
+	limb_t (*sub_n)(limb_t *, const limb_t *, const limb_t *, size_t, limb_t);
+	int (*cmp_n)(const limb_t *, const limb_t *, size_t);
+	size_t (*normalized_size)(const limb_t *, size_t);
+};
+
+inline const LimbKernels SCALAR_KERNELS = {"scalar", limbs_add_n_scalar, limbs_sub_n_scalar, limbs_cmp_n_scalar, limbs_normalized_size_scalar};
+
+//Kernel sets this CPU can run, best first
+inline vector<LimbKernels> available_limb_kernels(){
+	vector<LimbKernels> k;
+#if defined(__x86_64__)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512f"))
+		k.push_back({"avx512", limbs_add_n_avx512, limbs_sub_n_avx512, limbs_cmp_n_avx512, limbs_normalized_size_avx512});
+	if(__builtin_cpu_supports("avx2"))
+		k.push_back({"avx2", limbs_add_n_avx2, limbs_sub_n_avx2, limbs_cmp_n_avx2, limbs_normalized_size_avx2});
+#elif defined(__aarch64__)
+	k.push_back({"neon", limbs_add_n_scalar, limbs_sub_n_scalar, limbs_cmp_n_neon, limbs_normalized_size_neon});
+#endif
+	k.push_back(SCALAR_KERNELS);
+	return k;
+}
+
+inline LimbKernels LIMB_KERNELS = available_limb_kernels()[0];
+
+//Below this many limbs the plain loops win over a call through LIMB_KERNELS
+inline const size_t VECTOR_KERNEL_MIN_LIMBS = 16;
+
+			/* * * * Limb kernels * * * */
+
+//All kernels work on little-endian limb arrays. Unless stated otherwise
+//the result may alias the first operand.
+
+//Compare a[0..n) with b[0..m), both without leading zero limbs
+inline int limbs_cmp(const limb_t *a, size_t n, const limb_t *b, size_t m){
+	if(n != m)
+		return n < m ? -1 : 1;
+	return n < VECTOR_KERNEL_MIN_LIMBS ? limbs_cmp_n_scalar(a, b, n) : LIMB_KERNELS.cmp_n(a, b, n);
+}
+
+//r[0..n) = a[0..n) + b[0..m), n >= m, returns the carry out
+inline limb_t limbs_add(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	limb_t c = m < VECTOR_KERNEL_MIN_LIMBS ? limbs_add_n_scalar(r, a, b, m, 0) : LIMB_KERNELS.add_n(r, a, b, m, 0);
+	size_t i = m;
+	for (; i < n && c; i++){
+		r[i] = a[i] + 1;
+		c = (r[i] == 0);
+	}
+	if(r != a)
+		for (; i < n; i++)
+			r[i] = a[i];
+	return c;
+}
+
+//r[0..n) = a[0..n) - b[0..m), n >= m, returns the borrow out
+inline limb_t limbs_sub(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	limb_t c = m < VECTOR_KERNEL_MIN_LIMBS ? limbs_sub_n_scalar(r, a, b, m, 0) : LIMB_KERNELS.sub_n(r, a, b, m, 0);
+	size_t i = m;
+	for (; i < n && c; i++){
+		c = (a[i] == 0);
+		r[i] = a[i] - 1;
+	}
+	if(r != a)
+		for (; i < n; i++)
+			r[i] = a[i];
+	return c;
+}
+
+//r[0..n) = |a[0..n) - b[0..m)| for n >= m, where a has no leading zero limb
+//when n > m; returns whether b > a. Equal high limbs are cleared, then the
+//smaller tail is subtracted from the larger, so the sign comes out of the same
+//pass as the difference. r may be a or b.
+inline bool limbs_sub_abs(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	if(n > m){
+		limbs_sub(r, a, n, b, m);
+		return false;
+	}
+	for (; n && a[n - 1] == b[n - 1]; n--)
+		r[n - 1] = 0;
+	bool swapped = n && a[n - 1] < b[n - 1];
+	if(swapped)
+		swap(a, b);
+	limbs_sub(r, a, n, b, n);
+	return swapped;
+}
+
+//r[0..n) = a[0..n) * b, returns the high limb
+inline limb_t limbs_mul_1(limb_t *r, const limb_t *a, size_t n, limb_t b){
+	limb_t c = 0;
+	for (size_t i = 0; i < n; i++){
+		dlimb_t p = (dlimb_t)a[i] * b + c;
+		r[i] = (limb_t)p;
+		c = (limb_t)(p >> 64);
+	}
+	return c;
+}
+
+//r[0..n) += a[0..n) * b, returns the high limb
+inline limb_t limbs_addmul_1(limb_t *r, const limb_t *a, size_t n, limb_t b){
+	limb_t c = 0;
+	for (size_t i = 0; i < n; i++){
+		dlimb_t p = (dlimb_t)a[i] * b + r[i] + c;
+		r[i] = (limb_t)p;
+		c = (limb_t)(p >> 64);
+	}
+	return c;
+}
+
+//Reciprocal floor((B^2 - 1) / d) - B of a normalized d (top bit set)
+inline limb_t limb_reciprocal(limb_t d){
+	return (limb_t)((((dlimb_t)~d) << 64 | ~(limb_t)0) / d);
+}
+
+//(u1, u0) / d for a normalized d with reciprocal v and u1 < d, following
+//Moller and Granlund's "Improved division by invariant integers"
+inline limb_t limb_div_2by1(limb_t &r, limb_t u1, limb_t u0, limb_t d, limb_t v){
+	dlimb_t p = (dlimb_t)v * u1 + (((dlimb_t)(u1 + 1) << 64) | u0);
+	limb_t q1 = (limb_t)(p >> 64), q0 = (limb_t)p;
+	r = u0 - q1 * d;
+	if(r > q0){
+		q1--;
+		r += d;
+	}
+	if(r >= d){
+		q1++;
+		r -= d;
+	}
+	return q1;
+}
+
+//q[0..n) = a[0..n) / d, returns the remainder; q may be null when only the
+//remainder is needed
+inline limb_t limbs_divrem_1(limb_t *q, const limb_t *a, size_t n, limb_t d){
+	if(!n)
+		return 0;
+	unsigned s = __builtin_clzll(d);
+	d <<= s;
+	limb_t v = limb_reciprocal(d), r = s ? a[n - 1] >> (64 - s) : 0;
+	for (size_t i = n; i-- > 0;){
+		limb_t u0 = a[i] << s;
+		if(s && i)
+			u0 |= a[i - 1] >> (64 - s);
+		limb_t qi = limb_div_2by1(r, r, u0, d, v);
+		if(q)
+			q[i] = qi;
+	}
+	return r >> s;
+}
+
+//Inverse of an odd d modulo 2^64; Newton's iteration doubles the correct low
+//bits from 3 to 96
+inline limb_t limb_inverse(limb_t d){
+	limb_t inv = d;
+	for (int i = 0; i < 5; i++)
+		inv *= 2 - d * inv;
+	return inv;
+}
+
+//q[0..n) = a[0..n) / d for a d known to divide a, by Jebelean's exact division:
+//each quotient limb is the low limb of the running remainder times d^-1, so no
+//division is performed. q may alias a.
+inline void limbs_divexact_1(limb_t *q, const limb_t *a, size_t n, limb_t d){
+	unsigned t = __builtin_ctzll(d);
+	d >>= t;
+	limb_t inv = limb_inverse(d), c = 0;
+	for (size_t i = 0; i < n; i++){
+		limb_t s = t ? (a[i] >> t) | (i + 1 < n ? a[i + 1] << (64 - t) : 0) : a[i];
+		limb_t l = s - c;
+		c = l > s;
+		limb_t qi = l * inv;
+		q[i] = qi;
+		c += (limb_t)(((dlimb_t)qi * d) >> 64);
+	}
+}
+
+//r[0..n+m) = a[0..n) * b[0..m), r must not overlap a or b
+inline void limbs_mul_basecase(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	r[n] = limbs_mul_1(r, a, n, b[0]);
+	for (size_t j = 1; j < m; j++)
+		r[n + j] = limbs_addmul_1(r + j, a, n, b[j]);
+}
+
+inline const limb_t ONE_LIMB = 1;
+
+//Number of limbs of a[0..n) once leading zeros are dropped
+inline size_t limbs_normalized_size(const limb_t *a, size_t n){
+	if(!n || a[n - 1])
+		return n;
+	return n < VECTOR_KERNEL_MIN_LIMBS ? limbs_normalized_size_scalar(a, n) : LIMB_KERNELS.normalized_size(a, n);
+}
+
+template<class Limbs>
+inline void limbs_trim(Limbs &v){
+	v.resize(limbs_normalized_size(v.data(), v.size()));
+}
+
+			/* * * * Instrumentation * * * */
+
+//Per-operation counters for tuning the thresholds against real traffic,
+//compiled in only when BIGINT_STATS is defined; otherwise the hooks are empty
+//and snapshots stay zero. Only calls through the BigInt API and the decimal
+//conversions are counted, not the recursion inside them, with operands sized
+//in limbs of the smaller one for a multiplication, of the divisor for a
+//division and of the result for a parse. Each thread counts into its own
+//block with plain relaxed stores; snapshot() sums the blocks of all threads,
+//those that have exited included. Cycles are TSC ticks on x86 and steady
+//clock ticks elsewhere, and include work the call handed to the pool. Bytes
+//are limb storage allocated while the operation ran, scratch vectors aside.
+class BigIntStats{
+public:
+	enum Op{ MUL, SQR, DIV, PARSE, PRINT, OPS };
+	enum Tier{ SINGLE_LIMB, BASECASE, UNBALANCED, KARATSUBA, TOOM3, NTT, KNUTH, BURNIKEL_ZIEGLER, DIVIDE_CONQUER, TIERS };
+	//Bucket k holds operands of 2^(k-1) to 2^k - 1 limbs
+	static const size_t SIZES = 48;
+	struct Counters{
+		uint64_t calls, bytes, cycles;
+		uint64_t sizes[SIZES];
+		uint64_t tiers[TIERS];
+	};
+	Counters ops[OPS] = {};
+
+	static const char *op_name(Op op){
+		static const char *const names[OPS] = {"mul", "sqr", "div", "parse", "print"};
+		return names[op];
+	}
+	static const char *tier_name(Tier t){
+		static const char *const names[TIERS] = {"single_limb", "basecase", "unbalanced", "karatsuba",
+			"toom3", "ntt", "knuth", "burnikel_ziegler", "divide_conquer"};
+		return names[t];
+	}
+
+	//Totals over all threads since the last reset
+	static BigIntStats snapshot();
+	static void reset();
+	//One "op.counter value" line per nonzero counter, for a metrics pipeline
+	void dump(ostream &out)const;
+
+	//Counts one call from construction to destruction
+	class Scope;
+	//Charges n bytes to the operation running on this thread, if any
+	static void count_bytes(size_t n);
+
+private:
+	static const size_t WORDS_PER_OP = sizeof(Counters) / sizeof(uint64_t), WORDS = WORDS_PER_OP * OPS;
+	static size_t word(Op op, size_t offset){
+		return op * WORDS_PER_OP + offset / sizeof(uint64_t);
+	}
+
+	//Counters of one thread, written only by their owner
+	struct Block{
+		atomic<uint64_t> words[WORDS] = {};
+		Block();
+		~Block();
+		void add(size_t i, uint64_t d){
+			words[i].store(words[i].load(memory_order_relaxed) + d, memory_order_relaxed);
+		}
+	};
+	//Never destroyed, so threads may still retire their blocks during exit
+	struct Registry{
+		mutex lock;
+		vector<Block *> live;
+		uint64_t retired[WORDS] = {}, baseline[WORDS] = {};
+	};
+	static Registry &registry(){
+		static Registry *r = new Registry;
+		return *r;
+	}
+	static Block &local(){
+		thread_local Block b;
+		return b;
+	}
+	static Op &active(){
+		thread_local Op op = OPS;
+		return op;
+	}
+	static void totals(const Registry &reg, uint64_t *w){
+		for (size_t i = 0; i < WORDS; i++){
+			w[i] = reg.retired[i];
+			for (Block *b : reg.live)
+				w[i] += b->words[i].load(memory_order_relaxed);
+		}
+	}
+	static uint64_t clock(){
+#if defined(__x86_64__)
+		return __rdtsc();
+#else
+		return chrono::steady_clock::now().time_since_epoch().count();
+#endif
+	}
+};
+
+#ifdef BIGINT_STATS
+class BigIntStats::Scope{
+	Block &b;
+	Op op, outer;
+	uint64_t start;
+public:
+	Scope(Op op, size_t limbs, Tier tier) : b(local()), op(op), outer(exchange(active(), op)){
+		size_t k = limbs ? min((size_t)(64 - __builtin_clzll(limbs)), SIZES - 1) : 0;
+		b.add(word(op, offsetof(Counters, calls)), 1);
+		b.add(word(op, offsetof(Counters, sizes) + k * sizeof(uint64_t)), 1);
+		b.add(word(op, offsetof(Counters, tiers) + tier * sizeof(uint64_t)), 1);
+		start = clock();
+	}
+	~Scope(){
+		b.add(word(op, offsetof(Counters, cycles)), clock() - start);
+		active() = outer;
+	}
+	Scope(const Scope &) = delete;
+	Scope &operator=(const Scope &) = delete;
+};
+inline void BigIntStats::count_bytes(size_t n){
+	if(active() != OPS)
+		local().add(word(active(), offsetof(Counters, bytes)), n);
+}
+#else
+class BigIntStats::Scope{
+public:
+	Scope(Op, size_t, Tier){
+	}
+};
+inline void BigIntStats::count_bytes(size_t){
+}
+#endif
+
+inline BigIntStats::Block::Block(){
+	Registry &reg = registry();
+	lock_guard<mutex> guard(reg.lock);
+	reg.live.push_back(this);
+}
+inline BigIntStats::Block::~Block(){
+	Registry &reg = registry();
+	lock_guard<mutex> guard(reg.lock);
+	for (size_t i = 0; i < WORDS; i++)
+		reg.retired[i] += words[i].load(memory_order_relaxed);
+	reg.live.erase(find(reg.live.begin(), reg.live.end(), this));
+}
+inline BigIntStats BigIntStats::snapshot(){
+	Registry &reg = registry();
+	lock_guard<mutex> guard(reg.lock);
+	uint64_t w[WORDS];
+	totals(reg, w);
+	for (size_t i = 0; i < WORDS; i++)
+		w[i] -= reg.baseline[i];
+	BigIntStats s;
+	static_assert(sizeof(s.ops) == sizeof(w), "Counters must be plain words");
+	memcpy(s.ops, w, sizeof(w));
+	return s;
+}
+//Other threads keep writing their own blocks, so a reset only moves the baseline
+inline void BigIntStats::reset(){
+	Registry &reg = registry();
+	lock_guard<mutex> guard(reg.lock);
+	totals(reg, reg.baseline);
+}
+inline void BigIntStats::dump(ostream &out)const{
+	for (size_t i = 0; i < OPS; i++){
+		const Counters &c = ops[i];
+		const char *name = op_name((Op)i);
+		if(!c.calls)
+			continue;
+		out << name << ".calls " << c.calls << '\n';
+		out << name << ".bytes " << c.bytes << '\n';
+		out << name << ".cycles " << c.cycles << '\n';
+		for (size_t t = 0; t < TIERS; t++)
+			if(c.tiers[t])
+				out << name << ".tier." << tier_name((Tier)t) << ' ' << c.tiers[t] << '\n';
+		for (size_t k = 0; k < SIZES; k++)
+			if(c.sizes[k])
+				out << name << ".limbs." << (k ? 1ULL << (k - 1) : 0) << ' ' << c.sizes[k] << '\n';
+	}
+}
+
+			/* * * * Limb storage * * * */
+
+//Memory resource that new limb buffers on this thread are drawn from
+inline pmr::memory_resource *&limb_resource(){
+	thread_local pmr::memory_resource *res = pmr::new_delete_resource();
+	return res;
+}
+
+//Vector-like limb array that keeps up to two limbs in place, so values below
+//2^128 never touch the heap; it switches to a heap buffer once it grows past that.
+//The buffer comes from the thread's limb_resource() at construction time and,
+//like a pmr container, the resource stays with the object for its lifetime.
+class LimbStorage{
+	static const size_t INLINE_LIMBS = 2;
+	size_t len, cap;
+	pmr::memory_resource *res;
+	union{
+		limb_t local[INLINE_LIMBS];
+		limb_t *heap;
+	};
+	bool on_heap()const{
+		return cap > INLINE_LIMBS;
+	}
+	void release(){
+		if(on_heap())
+			res->deallocate(heap, cap * sizeof(limb_t), alignof(limb_t));
+		len = 0;
+		cap = INLINE_LIMBS;
+	}
+	//Takes over o's buffer and resource, o must not own one of its own afterwards
+	void steal(LimbStorage &o){
+		len = o.len;
+		cap = o.cap;
+		res = o.res;
+		if(o.on_heap())
+			heap = o.heap;
+		else
+			memcpy(local, o.local, len * sizeof(limb_t));
+		o.len = 0;
+		o.cap = INLINE_LIMBS;
+	}
+public:
+	LimbStorage() : len(0), cap(INLINE_LIMBS), res(limb_resource()){
+	}
+	LimbStorage(const LimbStorage &o) : len(0), cap(INLINE_LIMBS), res(limb_resource()){
+		assign(o.data(), o.len);
+	}
+	LimbStorage(LimbStorage &&o) noexcept{
+		steal(o);
+	}
+	~LimbStorage(){
+		release();
+	}
+	LimbStorage &operator=(const LimbStorage &o){
+		if(this != &o)
+			assign(o.data(), o.len);
+		return *this;
+	}
+	//Buffers only change hands within one resource, otherwise the limbs are
+	//copied so a value never ends up owning memory from an arena it outlives
+	LimbStorage &operator=(LimbStorage &&o){
+		if(this == &o)
+			return *this;
+		if(o.on_heap() && o.res == res){
+			release();
+			len = o.len;
+			cap = o.cap;
+			heap = o.heap;
+			o.len = 0;
+			o.cap = INLINE_LIMBS;
+		}
+		else{
+			assign(o.data(), o.len);
+			o.clear();
+		}
+		return *this;
+	}
+	LimbStorage &operator=(const vector<limb_t> &v){
+		assign(v.data(), v.size());
+		return *this;
+	}
+
+	size_t size()const{
+		return len;
+	}
+	bool empty()const{
+		return !len;
+	}
+	limb_t *data(){
+		return on_heap() ? heap : local;
+	}
+	const limb_t *data()const{
+		return on_heap() ? heap : local;
+	}
+	limb_t &operator[](size_t i){
+		return data()[i];
+	}
+	limb_t operator[](size_t i)const{
+		return data()[i];
+	}
+	limb_t back()const{
+		return data()[len - 1];
+	}
+
+	//Makes room for n limbs, growing geometrically so push_back stays amortized O(1)
+	void reserve(size_t n){
+		if(n <= cap)
+			return;
+		size_t c = max(n, 2 * len);
+		limb_t *p = (limb_t *)res->allocate(c * sizeof(limb_t), alignof(limb_t));
+		BigIntStats::count_bytes(c * sizeof(limb_t));
+		memcpy(p, data(), len * sizeof(limb_t));
+		if(on_heap())
+			res->deallocate(heap, cap * sizeof(limb_t), alignof(limb_t));
+		heap = p;
+		cap = c;
+	}
+	//New limbs are zero, like vector::resize
+	void resize(size_t n){
+		reserve(n);
+		if(n > len)
+			memset(data() + len, 0, (n - len) * sizeof(limb_t));
+		len = n;
+	}
+	void assign(const limb_t *p, size_t n){
+		len = 0;
+		reserve(n);
+		copy(p, p + n, data());
+		len = n;
+	}
+	void push_back(limb_t x){
+		reserve(len + 1);
+		data()[len++] = x;
+	}
+	void pop_back(){
+		len--;
+	}
+	void clear(){
+		len = 0;
+	}
+	void swap(LimbStorage &o){
+		LimbStorage t(move(o));
+		o = move(*this);
+		*this = move(t);
+	}
+	friend bool operator==(const LimbStorage &a, const LimbStorage &b){
+		return a.len == b.len && !memcmp(a.data(), b.data(), a.len * sizeof(limb_t));
+	}
+};
+
+//Routes every BigInt created on this thread inside its scope to one memory
+//resource, by default a monotonic arena that frees everything at once when
+//the scope ends. Results that must outlive the scope have to be assigned to
+//a BigInt constructed outside it, which copies them out of the arena.
+class BigIntArena{
+	pmr::monotonic_buffer_resource arena;
+	pmr::memory_resource *prev;
+public:
+	BigIntArena() : prev(exchange(limb_resource(), &arena)){
+	}
+	explicit BigIntArena(size_t initial_bytes) : arena(initial_bytes), prev(exchange(limb_resource(), &arena)){
+	}
+	//Uses an existing resource instead, such as a pmr::unsynchronized_pool_resource
+	explicit BigIntArena(pmr::memory_resource *r) : prev(exchange(limb_resource(), r)){
+	}
+	~BigIntArena(){
+		limb_resource() = prev;
+	}
+	BigIntArena(const BigIntArena &) = delete;
+	BigIntArena &operator=(const BigIntArena &) = delete;
+};
+
+			/* * * * Parallel execution * * * */
+
+//Work-stealing pool shared by the large multiplication tiers and the decimal
+//parser. Every thread of the pool owns a deque of tasks: it pushes and pops
+//at the back while idle threads steal from the front of the others. A thread
+//waiting for its tasks runs queued ones instead of blocking, so nested
+//parallel calls keep every thread busy and cannot deadlock. Threads outside
+//the pool share queue 0. The pool starts serial; set_threads(n) runs work on
+//n threads counting the caller, and must not be called while any is running.
+class BigIntThreadPool{
+	struct Task{
+		function<void()> run;
+		atomic<bool> done{false};
+		exception_ptr error;
+	};
+	struct Queue{
+		mutex lock;
+		deque<Task *> tasks;
+	};
+
+	static inline atomic<unsigned> count{1};
+	vector<unique_ptr<Queue>> queues;
+	vector<thread> workers;
+	mutex sleep_lock;
+	condition_variable wake;
+	atomic<size_t> queued{0};
+	bool stopping = false;
+
+	static BigIntThreadPool &instance(){
+		static BigIntThreadPool pool;
+		return pool;
+	}
+	static size_t &own_queue(){
+		thread_local size_t q = 0;
+		return q;
+	}
+
+	BigIntThreadPool() : queues(1) {
+		queues[0] = make_unique<Queue>();
+	}
+	~BigIntThreadPool(){
+		stop();
+	}
+	void stop(){
+		{
+			lock_guard<mutex> guard(sleep_lock);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (thread &t : workers)
+			t.join();
+		workers.clear();
+		stopping = false;
+	}
+
+	//Own newest task first, then the oldest task of another queue
+	Task *take(){
+		size_t own = own_queue();
+		for (size_t i = 0; i < queues.size(); i++){
+			Queue &q = *queues[(own + i) % queues.size()];
+			lock_guard<mutex> guard(q.lock);
+			if(q.tasks.empty())
+				continue;
+			Task *t;
+			if(!i)
+				t = q.tasks.back(),
+				q.tasks.pop_back();
+			else
+				t = q.tasks.front(),
+				q.tasks.pop_front();
+			queued--;
+			return t;
+		}
+		return nullptr;
+	}
+	static void execute(Task *t){
+		try{
+			t->run();
+		}
+		catch(...){
+			t->error = current_exception();
+		}
+		t->done.store(true, memory_order_release);
+	}
+	void work(size_t q){
+		own_queue() = q;
+		while(true){
+			if(Task *t = take()){
+				execute(t);
+				continue;
+			}
+			unique_lock<mutex> guard(sleep_lock);
+			wake.wait(guard, [this](){
+				return stopping || queued > 0;
+			});
+			if(stopping)
+				return;
+		}
+	}
+
+	//Queues t[1..n), runs t[0] here and helps with queued work until all are done
+	void run(Task *t, size_t n){
+		{
+			Queue &q = *queues[own_queue()];
+			lock_guard<mutex> guard(q.lock);
+			for (size_t i = 1; i < n; i++)
+				q.tasks.push_back(&t[i]);
+			queued += n - 1;
+		}
+		{
+			lock_guard<mutex> guard(sleep_lock);
+		}
+		wake.notify_all();
+		execute(&t[0]);
+		for (size_t i = 0; i < n; i++)
+			while(!t[i].done.load(memory_order_acquire)){
+				if(Task *other = take())
+					execute(other);
+				else
+					this_thread::yield();
+			}
+		for (size_t i = 0; i < n; i++)
+			if(t[i].error)
+				rethrow_exception(t[i].error);
+	}
+
+public:
+	static void set_threads(unsigned n){
+		BigIntThreadPool &pool = instance();
+		pool.stop();
+		n = max(n, 1u);
+		pool.queues.resize(n);
+		for (unsigned i = 1; i < n; i++)
+			pool.queues[i] = make_unique<Queue>();
+		for (unsigned i = 1; i < n; i++)
+			pool.workers.emplace_back(&BigIntThreadPool::work, &pool, i);
+		count = n;
+	}
+	static unsigned threads(){
+		return count.load(memory_order_relaxed);
+	}
+
+	//Runs every f and returns once all have finished, in parallel when the pool has threads
+	template<class... F>
+	static void invoke(F &&...f){
+		if(threads() == 1){
+			(f(), ...);
+			return;
+		}
+		Task tasks[sizeof...(F)];
+		size_t i = 0;
+		((tasks[i++].run = [&f](){ f(); }), ...);
+		instance().run(tasks, sizeof...(F));
+	}
+
+	//Calls f(lo, hi) on pieces of [0, n) of at least grain elements, in parallel
+	//when there is more than one piece
+	template<class F>
+	static void parallel_for(size_t n, size_t grain, F f){
+		size_t pieces = min((size_t)threads() * 4, n / max(grain, (size_t)1));
+		if(threads() == 1 || pieces <= 1){
+			f((size_t)0, n);
+			return;
+		}
+		unique_ptr<Task[]> tasks(new Task[pieces]);
+		for (size_t i = 0; i < pieces; i++)
+			tasks[i].run = [&f, i, n, pieces](){
+				f(n * i / pieces, n * (i + 1) / pieces);
+			};
+		instance().run(tasks.get(), pieces);
+	}
+};
+
+			/* * * * Multiplication * * * */
+
+//Tunable algorithm thresholds, measured in limbs of the smaller operand
+struct BigIntTuning{
+	static inline size_t karatsuba_threshold = 32;
+	static inline size_t toom3_threshold = 200;
+	static inline size_t ntt_threshold = 2500;
+	static inline size_t karatsuba_sqr_threshold = 48;
+	static inline size_t toom3_sqr_threshold = 300;
+	static inline size_t ntt_sqr_threshold = 3000;
+	static inline size_t divide_bz_threshold = 60;
+	static inline size_t decimal_dc_threshold = 30;
+	//Smallest operand the gcd reduces by half-gcd rather than Lehmer steps
+	static inline size_t hgcd_threshold = 300;
+	//Smallest operand whose subproducts go to BigIntThreadPool
+	static inline size_t parallel_threshold = 1000;
+};
+
+//Runs every f, on the pool when the operands have at least n limbs
+template<class... F>
+inline void parallel_invoke(size_t n, F &&...f){
+	if(n >= BigIntTuning::parallel_threshold)
+		BigIntThreadPool::invoke(f...);
+	else
+		(f(), ...);
+}
+
+inline void limbs_mul(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m);
+inline void limbs_sqr(limb_t *r, const limb_t *a, size_t n);
+
+//r[0..2n) = a[0..n)^2, every cross product a[i] * a[j] is computed once
+inline void limbs_sqr_basecase(limb_t *r, const limb_t *a, size_t n){
+	fill(r, r + 2 * n, 0);
+	for (size_t i = 0; i + 1 < n; i++)
+		r[n + i] = limbs_addmul_1(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+	limb_t c = 0;
+	for (size_t i = 0; i < 2 * n; i++){
+		limb_t t = r[i];
+		r[i] = (t << 1) | c;
+		c = t >> 63;
+	}
+	c = 0;
+	for (size_t i = 0; i < n; i++){
+		dlimb_t sq = (dlimb_t)a[i] * a[i];
+		dlimb_t lo = (dlimb_t)r[2 * i] + (limb_t)sq + c;
+		dlimb_t hi = (dlimb_t)r[2 * i + 1] + (limb_t)(sq >> 64) + (limb_t)(lo >> 64);
+		r[2 * i] = (limb_t)lo;
+		r[2 * i + 1] = (limb_t)hi;
+		c = (limb_t)(hi >> 64);
+	}
+}
+
+//Signed magnitudes for the Toom-3 evaluation and interpolation steps
+struct SignedLimbs{
+	vector<limb_t> mag;
+	bool neg = false;
+};
+
+inline SignedLimbs slimbs_from(const limb_t *a, size_t n){
+	SignedLimbs r;
+	r.mag.assign(a, a + limbs_normalized_size(a, n));
+	return r;
+}
+
+inline SignedLimbs slimbs_add(const SignedLimbs &a, const SignedLimbs &b){
+	const SignedLimbs *x = &a, *y = &b;
+	SignedLimbs r;
+	if(a.neg == b.neg){
+		if(x->mag.size() < y->mag.size())
+			swap(x, y);
+		r.mag.resize(x->mag.size() + 1);
+		r.mag.back() = limbs_add(r.mag.data(), x->mag.data(), x->mag.size(), y->mag.data(), y->mag.size());
+		r.neg = a.neg;
+	}
+	else{
+		if(x->mag.size() < y->mag.size())
+			swap(x, y);
+		r.mag.resize(x->mag.size());
+		r.neg = x->neg != limbs_sub_abs(r.mag.data(), x->mag.data(), x->mag.size(), y->mag.data(), y->mag.size());
+	}
+	limbs_trim(r.mag);
+	if(r.mag.empty())
+		r.neg = false;
+	return r;
+}
+
+inline SignedLimbs slimbs_sub(const SignedLimbs &a, SignedLimbs b){
+	if(!b.mag.empty())
+		b.neg = !b.neg;
+	return slimbs_add(a, b);
+}
+
+inline SignedLimbs slimbs_mul(const SignedLimbs &a, const SignedLimbs &b){
+	SignedLimbs r;
+	if(a.mag.empty() || b.mag.empty())
+		return r;
+	r.mag.resize(a.mag.size() + b.mag.size());
+	if(&a == &b)
+		limbs_sqr(r.mag.data(), a.mag.data(), a.mag.size());
+	else
+		limbs_mul(r.mag.data(), a.mag.data(), a.mag.size(), b.mag.data(), b.mag.size());
+	limbs_trim(r.mag);
+	r.neg = a.neg != b.neg;
+	return r;
+}
+
+//Exact division by a single limb; used for the /2 and /3 interpolation steps
+inline void slimbs_divexact_1(SignedLimbs &a, limb_t d){
+	limbs_divexact_1(a.mag.data(), a.mag.data(), a.mag.size(), d);
+	limbs_trim(a.mag);
+}
+
+//Sum a[0..n) * b[0..m) for n much larger than m, one m x m block at a time
+inline void limbs_mul_unbalanced(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	vector<limb_t> t(2 * m);
+	size_t len = min(n, m);
+	limbs_mul(r, a, len, b, m);
+	for (size_t i = len; i < n; i += len){
+		len = min(n - i, m);
+		limbs_mul(t.data(), a + i, len, b, m);
+		//r already holds limbs up to i + m; the new block extends it
+		fill(r + i + m, r + i + len + m, 0);
+		limbs_add(r + i, r + i, len + m, t.data(), len + m);
+	}
+}
+
+//Karatsuba: three half-size products, requires n >= m > ceil(n / 2)
+inline void limbs_mul_karatsuba(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	size_t h = (n + 1) / 2, n1 = n - h, m1 = m - h;
+	vector<limb_t> sa(h + 1), sb(h + 1), t(2 * h + 2);
+	sa[h] = limbs_add(sa.data(), a, h, a + h, n1);
+	sb[h] = limbs_add(sb.data(), b, h, b + h, m1);
+	parallel_invoke(m,
+		[&](){ limbs_mul(r, a, h, b, h); },
+		[&](){ limbs_mul(r + 2 * h, a + h, n1, b + h, m1); },
+		[&](){ limbs_mul(t.data(), sa.data(), h + 1, sb.data(), h + 1); });
+	limbs_sub(t.data(), t.data(), t.size(), r, 2 * h);
+	limbs_sub(t.data(), t.data(), t.size(), r + 2 * h, n1 + m1);
+	limbs_add(r + h, r + h, n + m - h, t.data(), limbs_normalized_size(t.data(), t.size()));
+}
+
+//Karatsuba squaring: a0^2, a1^2 and (a0 - a1)^2, so no carry limb is needed
+inline void limbs_sqr_karatsuba(limb_t *r, const limb_t *a, size_t n){
+	size_t h = (n + 1) / 2, n1 = n - h;
+	size_t na0 = limbs_normalized_size(a, h), na1 = limbs_normalized_size(a + h, n1);
+	vector<limb_t> d(h, 0), t(2 * h), mid(2 * h + 1);
+	if(limbs_cmp(a, na0, a + h, na1) >= 0)
+		limbs_sub(d.data(), a, na0, a + h, na1);
+	else
+		limbs_sub(d.data(), a + h, na1, a, na0);
+	parallel_invoke(n,
+		[&](){ limbs_sqr(r, a, h); },
+		[&](){ limbs_sqr(r + 2 * h, a + h, n1); },
+		[&](){ limbs_sqr(t.data(), d.data(), h); });
+	mid[2 * h] = limbs_add(mid.data(), r, 2 * h, r + 2 * h, 2 * n1);
+	limbs_sub(mid.data(), mid.data(), mid.size(), t.data(), t.size());
+	limbs_add(r + h, r + h, 2 * n - h, mid.data(), limbs_normalized_size(mid.data(), mid.size()));
+}
+
+//Toom-3 with Bodrato's evaluation points 0, 1, -1, -2 and infinity;
+//requires n >= m > 2 * ceil(n / 3). Squares when b is a.
+inline void limbs_mul_toom3(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	bool square = (a == b && n == m);
+	size_t k = (n + 2) / 3;
+	SignedLimbs a0 = slimbs_from(a, k), a1 = slimbs_from(a + k, k), a2 = slimbs_from(a + 2 * k, n - 2 * k);
+	SignedLimbs b0, b1, b2;
+	if(!square)
+		b0 = slimbs_from(b, k),
+		b1 = slimbs_from(b + k, k),
+		b2 = slimbs_from(b + 2 * k, m - 2 * k);
+
+	//Evaluation
+	SignedLimbs p = slimbs_add(a0, a2), ap1 = slimbs_add(p, a1), am1 = slimbs_sub(p, a1);
+	SignedLimbs am2 = slimbs_add(am1, a2);
+	am2 = slimbs_sub(slimbs_add(am2, am2), a0);
+	SignedLimbs bp1, bm1, bm2;
+	if(!square){
+		SignedLimbs q = slimbs_add(b0, b2);
+		bp1 = slimbs_add(q, b1);
+		bm1 = slimbs_sub(q, b1);
+		bm2 = slimbs_add(bm1, b2);
+		bm2 = slimbs_sub(slimbs_add(bm2, bm2), b0);
+	}
+
+	//Pointwise products
+	SignedLimbs v0, v1, vm1, vm2, vinf;
+	if(square)
+		parallel_invoke(m,
+			[&](){ v0 = slimbs_mul(a0, a0); },
+			[&](){ v1 = slimbs_mul(ap1, ap1); },
+			[&](){ vm1 = slimbs_mul(am1, am1); },
+			[&](){ vm2 = slimbs_mul(am2, am2); },
+			[&](){ vinf = slimbs_mul(a2, a2); });
+	else
+		parallel_invoke(m,
+			[&](){ v0 = slimbs_mul(a0, b0); },
+			[&](){ v1 = slimbs_mul(ap1, bp1); },
+			[&](){ vm1 = slimbs_mul(am1, bm1); },
+			[&](){ vm2 = slimbs_mul(am2, bm2); },
+			[&](){ vinf = slimbs_mul(a2, b2); });
+
+	//Interpolation
+	SignedLimbs r3 = slimbs_sub(vm2, v1);
+	slimbs_divexact_1(r3, 3);
+	SignedLimbs r1 = slimbs_sub(v1, vm1);
+	slimbs_divexact_1(r1, 2);
+	SignedLimbs r2 = slimbs_sub(vm1, v0);
+	r3 = slimbs_sub(r2, r3);
+	slimbs_divexact_1(r3, 2);
+	r3 = slimbs_add(r3, slimbs_add(vinf, vinf));
+	r2 = slimbs_sub(slimbs_add(r2, r1), vinf);
+	r1 = slimbs_sub(r1, r3);
+
+	//Recomposition; every coefficient is non-negative by now
+	fill(r, r + n + m, 0);
+	const SignedLimbs *coef[5] = {&v0, &r1, &r2, &r3, &vinf};
+	for (int i = 0; i < 5; i++)
+		if(!coef[i]->mag.empty())
+			limbs_add(r + i * k, r + i * k, n + m - i * k, coef[i]->mag.data(), coef[i]->mag.size());
+}
+
+			/* * * * Number-theoretic transform * * * */
+
+//Arithmetic modulo a prime P = c * 2^k + 1 < 2^31 with primitive root G.
+//The twiddle tables are shared by all transforms: roots[k][j] holds w^j for
+//the principal 2^(k+1)-th root of unity w. Each level is built once under a
+//mutex and published through levels, so transforms read them without a lock,
+//including from the tasks of a parallel transform.
+template<uint32_t P, uint32_t G>
+struct NttPrime{
+	static const int MAX_LEVELS = 26;
+	static inline vector<uint32_t> roots[MAX_LEVELS], iroots[MAX_LEVELS];
+	static inline atomic<int> levels{0};
+	static inline mutex growing;
+
+	static uint32_t mul(uint32_t a, uint32_t b){
+		return (uint64_t)a * b % P;
+	}
+	//With P < 2^31 a difference wraps to a top bit set exactly when it is
+	//negative, so P is added back through a mask: a compare and select here
+	//may be compiled into a branch that mispredicts on every other butterfly
+	static uint32_t add(uint32_t a, uint32_t b){
+		uint32_t t = a + b - P;
+		return t + (P & -(t >> 31));
+	}
+	static uint32_t sub(uint32_t a, uint32_t b){
+		uint32_t t = a - b;
+		return t + (P & -(t >> 31));
+	}
+	static uint32_t pow(uint32_t a, uint64_t e){
+		uint32_t r = 1;
+		for (; e; e >>= 1, a = mul(a, a))
+			if(e & 1)
+				r = mul(r, a);
+		return r;
+	}
+
+	//Makes the tables cover transforms of length n
+	static void prepare(size_t n){
+		int need = __builtin_ctzll(n);
+		if(levels.load(memory_order_acquire) >= need)
+			return;
+		lock_guard<mutex> guard(growing);
+		for (int k = levels.load(memory_order_relaxed); k < need; k++){
+			size_t h = (size_t)1 << k;
+			uint32_t w = pow(G, (P - 1) / (2 * h)), iw = pow(w, P - 2);
+			roots[k].resize(h);
+			iroots[k].resize(h);
+			roots[k][0] = iroots[k][0] = 1;
+			for (size_t j = 1; j < h; j++)
+				roots[k][j] = mul(roots[k][j - 1], w),
+				iroots[k][j] = mul(iroots[k][j - 1], iw);
+			levels.store(k + 1, memory_order_release);
+		}
+	}
+
+	//Calls f(s, j0, j1) on butterflies j0..j1 of every block s of the stage
+	//with half length h; the blocks, or the butterflies of each block when
+	//there are few blocks, are spread over the pool
+	template<class F>
+	static void for_each_butterfly(size_t n, size_t h, F f){
+		const size_t grain = 1 << 13;
+		if(h >= grain)
+			for (size_t s = 0; s < n; s += 2 * h)
+				BigIntThreadPool::parallel_for(h, grain, [&](size_t lo, size_t hi){
+					f(s, lo, hi);
+				});
+		else
+			BigIntThreadPool::parallel_for(n / (2 * h), grain / h, [&](size_t lo, size_t hi){
+				for (size_t s = lo * 2 * h; s < hi * 2 * h; s += 2 * h)
+					f(s, 0, h);
+			});
+	}
+
+	//Decimation in frequency: natural order in, bit-reversed order out
+	static void forward(uint32_t *a, size_t n){
+		for (size_t h = n / 2; h; h /= 2){
+			const uint32_t *w = roots[__builtin_ctzll(h)].data();
+			for_each_butterfly(n, h, [a, h, w](size_t s, size_t j0, size_t j1){
+				for (size_t j = j0; j < j1; j++){
+					uint32_t u = a[s + j], v = a[s + j + h];
+					a[s + j] = add(u, v);
+					a[s + j + h] = mul(sub(u, v), w[j]);
+				}
+			});
+		}
+	}
+
+	//Decimation in time: bit-reversed order in, natural order out, scaled by 1/n
+	static void inverse(uint32_t *a, size_t n){
+		for (size_t h = 1; h < n; h *= 2){
+			const uint32_t *w = iroots[__builtin_ctzll(h)].data();
+			for_each_butterfly(n, h, [a, h, w](size_t s, size_t j0, size_t j1){
+				for (size_t j = j0; j < j1; j++){
+					uint32_t u = a[s + j], v = mul(a[s + j + h], w[j]);
+					a[s + j] = add(u, v);
+					a[s + j + h] = sub(u, v);
+				}
+			});
+		}
+		uint32_t inv = pow(n, P - 2);
+		BigIntThreadPool::parallel_for(n, 1 << 14, [a, inv](size_t lo, size_t hi){
+			for (size_t i = lo; i < hi; i++)
+				a[i] = mul(a[i], inv);
+		});
+	}
+
+	//out[0..n) = a[0..na) reduced modulo P and zero padded, then transformed
+	static void load_forward(uint32_t *out, const uint32_t *a, size_t na, size_t n){
+		BigIntThreadPool::parallel_for(n, 1 << 14, [out, a, na](size_t lo, size_t hi){
+			for (size_t i = lo; i < hi; i++)
+				out[i] = i < na ? a[i] % P : 0;
+		});
+		forward(out, n);
+	}
+
+	//out[0..n) = cyclic convolution of the 32-bit pieces a and b modulo P;
+	//passing b == a squares with a single forward transform
+	static void convolve(uint32_t *out, const uint32_t *a, size_t na, const uint32_t *b, size_t nb, size_t n){
+		prepare(n);
+		vector<uint32_t> fb;
+		if(a == b)
+			load_forward(out, a, na, n);
+		else{
+			fb.resize(n);
+			parallel_invoke(n / 4,
+				[&](){ load_forward(out, a, na, n); },
+				[&](){ load_forward(fb.data(), b, nb, n); });
+		}
+		const uint32_t *y = a == b ? out : fb.data();
+		BigIntThreadPool::parallel_for(n, 1 << 14, [out, y](size_t lo, size_t hi){
+			for (size_t i = lo; i < hi; i++)
+				out[i] = mul(out[i], y[i]);
+		});
+		inverse(out, n);
+	}
+};
+
+//Three primes whose product exceeds 2^90, so the exact convolution of up to
+//2^25 pieces of 32 bits per operand can be recovered by the CRT
+typedef NttPrime<2013265921, 31> NttP1;
+typedef NttPrime<469762049, 3> NttP2;
+typedef NttPrime<1811939329, 13> NttP3;
+inline const size_t NTT_MAX_LENGTH = (size_t)1 << 26;
+
+//Whether an n x m limb product fits in the largest supported transform
+inline bool ntt_fits(size_t n, size_t m){
+	return 2 * (n + m) <= NTT_MAX_LENGTH;
+}
+
+inline vector<uint32_t> limbs_to_pieces(const limb_t *a, size_t n){
+	vector<uint32_t> p(2 * n);
+	for (size_t i = 0; i < n; i++)
+		p[2 * i] = (uint32_t)a[i],
+		p[2 * i + 1] = (uint32_t)(a[i] >> 32);
+	return p;
+}
+
+//Combine the three residues of every coefficient with Garner's algorithm and
+//propagate the carries into r[0..len) limbs
+inline void ntt_recompose(limb_t *r, size_t len, const uint32_t *r1, const uint32_t *r2, const uint32_t *r3){
+	const uint64_t P1 = 2013265921, P2 = 469762049, P3 = 1811939329;
+	static const uint32_t inv12 = NttP2::pow(P1 % P2, P2 - 2);
+	static const uint32_t inv123 = NttP3::pow(P1 * P2 % P3, P3 - 2);
+	dlimb_t carry = 0;
+	for (size_t i = 0; i < 2 * len; i++){
+		uint64_t x2 = NttP2::mul(NttP2::sub(r2[i], r1[i] % P2), inv12);
+		uint64_t v = r1[i] + P1 * x2;
+		uint64_t x3 = NttP3::mul(NttP3::sub(r3[i], v % P3), inv123);
+		carry += (dlimb_t)v + (dlimb_t)(P1 * P2) * x3;
+		uint32_t piece = (uint32_t)carry;
+		carry >>= 32;
+		if(i & 1)
+			r[i / 2] |= (limb_t)piece << 32;
+		else
+			r[i / 2] = piece;
+	}
+}
+
+//r[0..n+m) = a[0..n) * b[0..m) through three NTT convolutions; squares when b is a
+inline void limbs_mul_ntt(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	bool square = (a == b && n == m);
+	vector<uint32_t> pa = limbs_to_pieces(a, n), pb;
+	if(!square)
+		pb = limbs_to_pieces(b, m);
+	const uint32_t *qb = square ? pa.data() : pb.data();
+	size_t len = 1;
+	while(len < 2 * (n + m))
+		len *= 2;
+	vector<uint32_t> r1(len), r2(len), r3(len);
+	parallel_invoke(m,
+		[&](){ NttP1::convolve(r1.data(), pa.data(), pa.size(), qb, 2 * m, len); },
+		[&](){ NttP2::convolve(r2.data(), pa.data(), pa.size(), qb, 2 * m, len); },
+		[&](){ NttP3::convolve(r3.data(), pa.data(), pa.size(), qb, 2 * m, len); });
+	ntt_recompose(r, n + m, r1.data(), r2.data(), r3.data());
+}
+
+//Tier limbs_mul runs for n >= m >= 1 limbs
+inline BigIntStats::Tier limbs_mul_tier(size_t n, size_t m){
+	//Karatsuba needs at least 4 limbs so that its h + 1 limb subproduct shrinks
+	if(m < max(BigIntTuning::karatsuba_threshold, (size_t)4))
+		return BigIntStats::BASECASE;
+	if(m >= BigIntTuning::ntt_threshold && ntt_fits(n, m))
+		return BigIntStats::NTT;
+	if(2 * m <= n + 1)
+		return BigIntStats::UNBALANCED;
+	if(m < BigIntTuning::toom3_threshold || m <= 2 * ((n + 2) / 3))
+		return BigIntStats::KARATSUBA;
+	return BigIntStats::TOOM3;
+}
+//Tier limbs_sqr runs for n >= 1 limbs
+inline BigIntStats::Tier limbs_sqr_tier(size_t n){
+	if(n < max(BigIntTuning::karatsuba_sqr_threshold, (size_t)2))
+		return BigIntStats::BASECASE;
+	if(n >= BigIntTuning::ntt_sqr_threshold && ntt_fits(n, n))
+		return BigIntStats::NTT;
+	if(n < BigIntTuning::toom3_sqr_threshold || n <= 2 * ((n + 2) / 3))
+		return BigIntStats::KARATSUBA;
+	return BigIntStats::TOOM3;
+}
+
+//r[0..n+m) = a[0..n) * b[0..m), r must not overlap a or b
+inline void limbs_mul(limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	if(a == b && n == m){
+		limbs_sqr(r, a, n);
+		return;
+	}
+	if(n < m){
+		swap(a, b);
+		swap(n, m);
+	}
+	if(!m){
+		fill(r, r + n, 0);
+		return;
+	}
+	switch(limbs_mul_tier(n, m)){
+	case BigIntStats::BASECASE:
+		limbs_mul_basecase(r, a, n, b, m);
+		break;
+	case BigIntStats::NTT:
+		limbs_mul_ntt(r, a, n, b, m);
+		break;
+	case BigIntStats::UNBALANCED:
+		limbs_mul_unbalanced(r, a, n, b, m);
+		break;
+	case BigIntStats::KARATSUBA:
+		limbs_mul_karatsuba(r, a, n, b, m);
+		break;
+	default:
+		limbs_mul_toom3(r, a, n, b, m);
+	}
+}
+
+//r[0..2n) = a[0..n)^2, r must not overlap a
+inline void limbs_sqr(limb_t *r, const limb_t *a, size_t n){
+	switch(limbs_sqr_tier(n)){
+	case BigIntStats::BASECASE:
+		limbs_sqr_basecase(r, a, n);
+		break;
+	case BigIntStats::NTT:
+		limbs_mul_ntt(r, a, n, a, n);
+		break;
+	case BigIntStats::KARATSUBA:
+		limbs_sqr_karatsuba(r, a, n);
+		break;
+	default:
+		limbs_mul_toom3(r, a, n, a, n);
+	}
+}
+
+			/* * * * Division * * * */
+
+//r[0..n) -= a[0..n) * b, returns the borrow limb
+inline limb_t limbs_submul_1(limb_t *r, const limb_t *a, size_t n, limb_t b){
+	limb_t c = 0;
+	for (size_t i = 0; i < n; i++){
+		dlimb_t p = (dlimb_t)a[i] * b + c;
+		limb_t lo = (limb_t)p;
+		c = (limb_t)(p >> 64) + (r[i] < lo);
+		r[i] -= lo;
+	}
+	return c;
+}
+
+//r[0..n) = a[0..n) << s for 0 <= s < 64, returns the bits shifted out
+inline limb_t limbs_lshift(limb_t *r, const limb_t *a, size_t n, unsigned s){
+	if(!s){
+		copy(a, a + n, r);
+		return 0;
+	}
+	limb_t out = 0;
+	for (size_t i = 0; i < n; i++){
+		limb_t t = a[i];
+		r[i] = (t << s) | out;
+		out = t >> (64 - s);
+	}
+	return out;
+}
+
+//r[0..n) = a[0..n) >> s for 0 <= s < 64
+inline void limbs_rshift(limb_t *r, const limb_t *a, size_t n, unsigned s){
+	if(!s){
+		copy(a, a + n, r);
+		return;
+	}
+	for (size_t i = 0; i < n; i++)
+		r[i] = (a[i] >> s) | (i + 1 < n ? a[i + 1] << (64 - s) : 0);
+}
+
+//Knuth's Algorithm D. u[0..un) is the dividend with u[un - 1] < v[n - 1]
+//and is left holding the remainder in u[0..n); v[0..n) is normalized (top
+//bit set) with n >= 2; q receives un - n limbs.
+inline void limbs_div_knuth(limb_t *q, limb_t *u, size_t un, const limb_t *v, size_t n){
+	limb_t vtop = v[n - 1], vnext = v[n - 2];
+	for (size_t j = un - n; j-- > 0;){
+		limb_t qhat, rhat;
+		bool big = false;
+		if(u[j + n] >= vtop){
+			qhat = ~(limb_t)0;
+			dlimb_t r = (dlimb_t)u[j + n - 1] + vtop;
+			rhat = (limb_t)r;
+			big = (r >> 64) != 0;
+		}
+		else{
+			dlimb_t num = ((dlimb_t)u[j + n] << 64) | u[j + n - 1];
+			qhat = (limb_t)(num / vtop);
+			rhat = (limb_t)(num % vtop);
+		}
+		while(!big && (dlimb_t)qhat * vnext > (((dlimb_t)rhat << 64) | u[j + n - 2])){
+			qhat--;
+			dlimb_t r = (dlimb_t)rhat + vtop;
+			rhat = (limb_t)r;
+			big = (r >> 64) != 0;
+		}
+		limb_t borrow = limbs_submul_1(u + j, v, n, qhat);
+		if(u[j + n] < borrow){
+			qhat--;
+			u[j + n] += limbs_add(u + j, u + j, n, v, n);
+		}
+		u[j + n] -= borrow;
+		q[j] = qhat;
+	}
+}
+
+//Little helpers on trimmed limb vectors for the recursive division
+inline int vec_cmp(const vector<limb_t> &a, const vector<limb_t> &b){
+	return limbs_cmp(a.data(), a.size(), b.data(), b.size());
+}
+inline vector<limb_t> vec_mul(const vector<limb_t> &a, const vector<limb_t> &b){
+	vector<limb_t> r(a.size() + b.size());
+	if(!a.empty() && !b.empty())
+		limbs_mul(r.data(), a.data(), a.size(), b.data(), b.size());
+	limbs_trim(r);
+	return r;
+}
+//x += y[0..yn) * B^k
+inline void vec_add_shifted(vector<limb_t> &x, const limb_t *y, size_t yn, size_t k){
+	if(x.size() < yn + k)
+		x.resize(yn + k, 0);
+	x.push_back(limbs_add(x.data() + k, x.data() + k, x.size() - k, y, yn));
+	limbs_trim(x);
+}
+//x -= y, requires x >= y
+inline void vec_sub(vector<limb_t> &x, const vector<limb_t> &y){
+	limbs_sub(x.data(), x.data(), x.size(), y.data(), y.size());
+	limbs_trim(x);
+}
+//low[0..k) + high * B^k
+inline vector<limb_t> vec_concat(const limb_t *low, size_t k, const vector<limb_t> &high){
+	vector<limb_t> r(low, low + k);
+	r.insert(r.end(), high.begin(), high.end());
+	limbs_trim(r);
+	return r;
+}
+
+//q, r = a / b for a normalized b[0..n) and a < B^m * b with m = |a| - n <= n;
+//recursive division of Burnikel and Ziegler in the form of Modern Computer
+//Arithmetic, Algorithm 1.8
+inline void limbs_divrem_rec(vector<limb_t> &q, vector<limb_t> &r, const limb_t *a, size_t an, const limb_t *b, size_t n){
+	an = limbs_normalized_size(a, an);
+	if(an < n || limbs_cmp(a, an, b, n) < 0){
+		q.clear();
+		r.assign(a, a + an);
+		return;
+	}
+	size_t m = an - n;
+	//Below 4 the halved divisor could shrink to a single limb
+	if(m < max(BigIntTuning::divide_bz_threshold, (size_t)4)){
+		vector<limb_t> u(a, a + an);
+		u.push_back(0);
+		q.assign(m + 1, 0);
+		limbs_div_knuth(q.data(), u.data(), u.size(), b, n);
+		u.resize(n);
+		limbs_trim(q);
+		limbs_trim(u);
+		r.swap(u);
+		return;
+	}
+	size_t k = m / 2;
+	const limb_t *b1 = b + k;
+	vector<limb_t> b0(b, b + k), q1, r1, q0, r0;
+	limbs_trim(b0);
+
+	//High half of the quotient from the top limbs, then fix it up against b0
+	limbs_divrem_rec(q1, r1, a + 2 * k, an - 2 * k, b1, n - k);
+	vector<limb_t> x = vec_concat(a, 2 * k, r1), y = vec_mul(q1, b0);
+	y.insert(y.begin(), k, 0);
+	limbs_trim(y);
+	while(vec_cmp(x, y) < 0){
+		limbs_sub(q1.data(), q1.data(), q1.size(), &ONE_LIMB, 1);
+		limbs_trim(q1);
+		vec_add_shifted(x, b, n, k);
+	}
+	vec_sub(x, y);
+
+	//Low half the same way
+	if(x.size() > k)
+		limbs_divrem_rec(q0, r0, x.data() + k, x.size() - k, b1, n - k);
+	x = vec_concat(x.data(), min(k, x.size()), r0);
+	y = vec_mul(q0, b0);
+	while(vec_cmp(x, y) < 0){
+		limbs_sub(q0.data(), q0.data(), q0.size(), &ONE_LIMB, 1);
+		limbs_trim(q0);
+		vec_add_shifted(x, b, n, 0);
+	}
+	vec_sub(x, y);
+	r.swap(x);
+	q.swap(q0);
+	vec_add_shifted(q, q1.data(), q1.size(), k);
+}
+
+//Splits a long dividend u[0..un) into blocks whose quotients have at most n
+//limbs and divides each one recursively; same contract as limbs_div_knuth
+inline void limbs_div_bz(limb_t *q, limb_t *u, size_t un, const limb_t *v, size_t n){
+	size_t qn = un - n, pos = (qn - 1) / n * n;
+	vector<limb_t> rem(u + pos, u + un), qb, rb;
+	fill(q, q + qn, 0);
+	while(true){
+		limbs_divrem_rec(qb, rb, rem.data(), rem.size(), v, n);
+		copy(qb.begin(), qb.end(), q + pos);
+		if(!pos)
+			break;
+		pos -= n;
+		rem = vec_concat(u + pos, n, rb);
+	}
+	fill(u, u + n, 0);
+	copy(rb.begin(), rb.end(), u);
+}
+
+//Tier limbs_divrem runs for an n limb dividend and an m limb divisor
+inline BigIntStats::Tier limbs_divrem_tier(size_t n, size_t m){
+	if(m == 1)
+		return BigIntStats::SINGLE_LIMB;
+	if(m < BigIntTuning::divide_bz_threshold || n - m < BigIntTuning::divide_bz_threshold)
+		return BigIntStats::KNUTH;
+	return BigIntStats::BURNIKEL_ZIEGLER;
+}
+
+//q[0..n-m+1) = a[0..n) / b[0..m) and r[0..m) = a mod b;
+//requires n >= m >= 1 and b[m - 1] != 0
+inline void limbs_divrem(limb_t *q, limb_t *r, const limb_t *a, size_t n, const limb_t *b, size_t m){
+	if(m == 1){
+		r[0] = limbs_divrem_1(q, a, n, b[0]);
+		return;
+	}
+	//Normalize so that the divisor has its top bit set
+	unsigned s = __builtin_clzll(b[m - 1]);
+	vector<limb_t> u(n + 1), v(m);
+	limbs_lshift(v.data(), b, m, s);
+	u[n] = limbs_lshift(u.data(), a, n, s);
+	if(limbs_divrem_tier(n, m) == BigIntStats::KNUTH)
+		limbs_div_knuth(q, u.data(), n + 1, v.data(), m);
+	else
+		limbs_div_bz(q, u.data(), n + 1, v.data(), m);
+	limbs_rshift(r, u.data(), m, s);
+}
+
+//q[0..n-m+1) = a[0..n) / b[0..m) for a b known to divide a, with b[0] odd.
+//Jebelean's exact division fixes one quotient limb per step from the low end
+//and leaves a holding zeros.
+inline void limbs_divexact(limb_t *q, limb_t *a, size_t n, const limb_t *b, size_t m){
+	limb_t inv = limb_inverse(b[0]);
+	for (size_t i = 0; i + m <= n; i++){
+		limb_t qi = a[i] * inv;
+		q[i] = qi;
+		limb_t c = limbs_submul_1(a + i, b, m, qi);
+		if(i + m < n)
+			limbs_sub(a + i + m, a + i + m, n - i - m, &c, 1);
+	}
+}
+
+			/* * * * Decimal conversion * * * */
+
+//19 decimal digits are the most that fit in one limb
+inline const limb_t DEC_CHUNK = 10000000000000000000ULL;
+inline const int DEC_CHUNK_DIGITS = 19;
+
+//10^(19 * 2^k), built by repeated squaring on first use and kept for later
+//conversions in both directions. The lock is not held while squaring, which
+//may run on the pool; a thread that loses the race drops its square.
+inline const vector<limb_t> &decimal_power(size_t k){
+	static deque<vector<limb_t>> powers(1, vector<limb_t>(1, DEC_CHUNK));
+	static mutex lock;
+	unique_lock<mutex> guard(lock);
+	while(powers.size() <= k){
+		size_t have = powers.size();
+		const vector<limb_t> &p = powers.back();
+		guard.unlock();
+		vector<limb_t> sq(2 * p.size());
+		limbs_sqr(sq.data(), p.data(), p.size());
+		limbs_trim(sq);
+		guard.lock();
+		if(powers.size() == have)
+			powers.push_back(move(sq));
+	}
+	return powers[k];
+}
+
+//Upper bound on the number of decimal digits of a[0..n)
+inline size_t decimal_digits_bound(const limb_t *a, size_t n){
+	n = limbs_normalized_size(a, n);
+	if(!n)
+		return 1;
+	size_t bits = 64 * n - __builtin_clzll(a[n - 1]);
+	return (size_t)(bits * 0.30103) + 1;
+}
+
+//Writes exactly 19 digits of x, zero padded, into out
+inline void chunk_to_decimal(char *out, limb_t x){
+	static const char pairs[] =
+		"0001020304050607080910111213141516171819"
+		"2021222324252627282930313233343536373839"
+		"4041424344454647484950515253545556575859"
+		"6061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+	for (int i = DEC_CHUNK_DIGITS - 2; i > 0; i -= 2){
+		memcpy(out + i, pairs + 2 * (x % 100), 2);
+		x /= 100;
+	}
+	out[0] = '0' + x;
+}
+
+//Receives the digits of a conversion from the most significant one on and
+//drops the leading zeros. Digits land in buf; when a FILE or descriptor is
+//attached, buf is flushed to it whenever it fills up.
+struct DecimalSink{
+	char *buf;
+	size_t cap, used = 0, total = 0;
+	FILE *file = nullptr;
+	int fd = -1;
+	bool started = false;
+
+	DecimalSink(char *b, size_t c) : buf(b), cap(c) {}
+
+	void put(const char *s, size_t len){
+		if(!started){
+			while(len && *s == '0')
+				s++,
+				len--;
+			if(!len)
+				return;
+			started = true;
+		}
+		total += len;
+		while(len){
+			if(used == cap)
+				flush();
+			size_t k = min(len, cap - used);
+			memcpy(buf + used, s, k);
+			used += k;
+			s += k;
+			len -= k;
+		}
+	}
+	void zeros(size_t len){
+		char z[64];
+		memset(z, '0', sizeof(z));
+		while(started && len){
+			size_t k = min(len, sizeof(z));
+			put(z, k);
+			len -= k;
+		}
+	}
+	void flush(){
+		if(file){
+			if(fwrite(buf, 1, used, file) != used)
+				throw("WRITE ERROR");
+			used = 0;
+		}
+		else if(fd >= 0){
+			for (size_t done = 0; done < used; ){
+				ssize_t k = ::write(fd, buf + done, used - done);
+				if(k < 0 && errno != EINTR)
+					throw("WRITE ERROR");
+				if(k > 0)
+					done += k;
+			}
+			used = 0;
+		}
+	}
+	//Flushes what is left and returns the number of digits produced
+	size_t finish(){
+		if(!started){
+			started = true;
+			put("0", 1);
+		}
+		flush();
+		return total;
+	}
+};
+
+//Emits exactly width digits of a[0..n) < 10^width, zero padded, into sink.
+//Large values are split by the cached powers so every division is balanced.
+inline void limbs_to_decimal_rec(DecimalSink &sink, size_t width, const limb_t *a, size_t n){
+	n = limbs_normalized_size(a, n);
+	if(n < max(BigIntTuning::decimal_dc_threshold, (size_t)2)){
+		//a has at most decimal_digits_bound(a, n) digits, about 19.27 per
+		//limb; the rest is padding
+		size_t len = min(width, decimal_digits_bound(a, n));
+		vector<limb_t> q(a, a + n);
+		char digits[DEC_CHUNK_DIGITS];
+		vector<char> out(len);
+		for (size_t end = len; end; ){
+			chunk_to_decimal(digits, limbs_divrem_1(q.data(), q.data(), n, DEC_CHUNK));
+			n = limbs_normalized_size(q.data(), n);
+			size_t k = min(end, (size_t)DEC_CHUNK_DIGITS);
+			memcpy(out.data() + end - k, digits + DEC_CHUNK_DIGITS - k, k);
+			end -= k;
+		}
+		sink.zeros(width - len);
+		sink.put(out.data(), len);
+		return;
+	}
+	size_t k = 0, digits = DEC_CHUNK_DIGITS;
+	while(2 * digits <= width / 2)
+		k++,
+		digits *= 2;
+	const vector<limb_t> &p = decimal_power(k);
+	if(n < p.size()){
+		sink.zeros(width - digits);
+		limbs_to_decimal_rec(sink, digits, a, n);
+		return;
+	}
+	vector<limb_t> q(n - p.size() + 1), r(p.size());
+	limbs_divrem(q.data(), r.data(), a, n, p.data(), p.size());
+	limbs_to_decimal_rec(sink, width - digits, q.data(), q.size());
+	limbs_to_decimal_rec(sink, digits, r.data(), r.size());
+}
+
+//Tier limbs_to_decimal_rec starts in for a normalized n limb value
+inline BigIntStats::Tier decimal_print_tier(size_t n){
+	return n < max(BigIntTuning::decimal_dc_threshold, (size_t)2) ? BigIntStats::BASECASE : BigIntStats::DIVIDE_CONQUER;
+}
+
+//Writes the decimal form of a[0..n) into out, which must have room for
+//decimal_digits_bound(a, n) characters; returns the number written
+inline size_t limbs_to_decimal(char *out, const limb_t *a, size_t n){
+	BigIntStats::Scope stat(BigIntStats::PRINT, n, decimal_print_tier(n));
+	DecimalSink sink(out, decimal_digits_bound(a, n));
+	limbs_to_decimal_rec(sink, sink.cap, a, n);
+	return sink.finish();
+}
+
+//Streams the decimal form of a[0..n), after a minus sign when negative, through
+//a fixed size buffer into a FILE or a file descriptor
+inline size_t limbs_write_decimal(FILE *file, int fd, const limb_t *a, size_t n, bool negative){
+	BigIntStats::Scope stat(BigIntStats::PRINT, n, decimal_print_tier(n));
+	vector<char> buf(1 << 16);
+	DecimalSink sink(buf.data(), buf.size());
+	sink.file = file;
+	sink.fd = fd;
+	if(negative){
+		buf[0] = '-';
+		sink.used = sink.total = 1;
+	}
+	limbs_to_decimal_rec(sink, decimal_digits_bound(a, n), a, n);
+	return sink.finish();
+}
+
+template<class Limbs>
+inline string limbs_to_decimal(const Limbs &a){
+	string s(decimal_digits_bound(a.data(), a.size()), '0');
+	s.resize(limbs_to_decimal(&s[0], a.data(), a.size()));
+	return s;
+}
+
+//Eight ASCII characters at s as one little-endian word
+inline uint64_t load_8_chars(const char *s){
+	uint64_t x;
+	memcpy(&x, s, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	x = __builtin_bswap64(x);
+#endif
+	return x;
+}
+
+//Whether all eight characters of x are decimal digits, checked in one word:
+//each byte must look like 0x3? and still do so after adding 6
+inline bool are_8_digits(uint64_t x){
+	return ((x & 0xF0F0F0F0F0F0F0F0ULL) | (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+//Value of eight digits held in x, first digit in the lowest byte
+inline limb_t parse_8_digits(uint64_t x){
+	x -= 0x3030303030303030ULL;
+	x = x * 10 + (x >> 8);
+	x = (((x & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) + (((x >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+	return x;
+}
+
+//Length of the run of decimal digits at the start of s[0..n)
+inline size_t decimal_prefix_length(const char *s, size_t n){
+	size_t i = 0;
+	while(i + 8 <= n && are_8_digits(load_8_chars(s + i)))
+		i += 8;
+	while(i < n && isdigit((unsigned char)s[i]))
+		i++;
+	return i;
+}
+
+//Value of the len <= 19 digits at s, eight at a time; throws on a non-digit
+inline limb_t parse_chunk(const char *s, size_t len){
+	limb_t v = 0;
+	for (; len >= 8; s += 8, len -= 8){
+		uint64_t x = load_8_chars(s);
+		if(!are_8_digits(x))
+			throw("ERROR");
+		v = v * 100000000 + parse_8_digits(x);
+	}
+	for (; len; s++, len--){
+		if(!isdigit((unsigned char)*s))
+			throw("ERROR");
+		v = v * 10 + (*s - '0');
+	}
+	return v;
+}
+
+//Parses s[0..n), which holds at most a few chunks, limb by limb
+inline vector<limb_t> decimal_to_limbs_basecase(const char *s, size_t n){
+	static const limb_t scale[DEC_CHUNK_DIGITS + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000,
+		100000000, 1000000000, 10000000000, 100000000000, 1000000000000, 10000000000000,
+		100000000000000, 1000000000000000, 10000000000000000, 100000000000000000,
+		1000000000000000000, DEC_CHUNK};
+	vector<limb_t> r;
+	r.reserve(n / DEC_CHUNK_DIGITS + 1);
+	//Consume a short leading chunk so the rest splits evenly into 19 digits
+	size_t head = n % DEC_CHUNK_DIGITS;
+	if(!head)
+		head = DEC_CHUNK_DIGITS;
+	for (size_t i = 0; i < n; i += head, head = DEC_CHUNK_DIGITS){
+		limb_t chunk = parse_chunk(s + i, head);
+		limb_t c = limbs_mul_1(r.data(), r.data(), r.size(), scale[head]);
+		if(c)
+			r.push_back(c);
+		if(r.empty())
+			r.push_back(0);
+		c = limbs_add(r.data(), r.data(), r.size(), &chunk, 1);
+		if(c)
+			r.push_back(c);
+	}
+	limbs_trim(r);
+	return r;
+}
+
+//Parses s[0..n) as high * 10^(19 * 2^k) + low with both halves parsed recursively
+inline vector<limb_t> decimal_to_limbs_rec(const char *s, size_t n){
+	if(n < DEC_CHUNK_DIGITS * max(BigIntTuning::decimal_dc_threshold, (size_t)2))
+		return decimal_to_limbs_basecase(s, n);
+	size_t k = 0, digits = DEC_CHUNK_DIGITS;
+	while(2 * digits <= n / 2)
+		k++,
+		digits *= 2;
+	const vector<limb_t> &p = decimal_power(k);
+	vector<limb_t> high, low;
+	parallel_invoke(n / DEC_CHUNK_DIGITS,
+		[&](){ high = decimal_to_limbs_rec(s, n - digits); },
+		[&](){ low = decimal_to_limbs_rec(s + n - digits, digits); });
+	vector<limb_t> r(high.size() + p.size() + 1, 0);
+	if(!high.empty())
+		limbs_mul(r.data(), high.data(), high.size(), p.data(), p.size());
+	if(!low.empty())
+		limbs_add(r.data(), r.data(), r.size(), low.data(), low.size());
+	limbs_trim(r);
+	return r;
+}
+//Value of the n digits at s, throws unless n >= 1 and all are digits
+inline vector<limb_t> decimal_to_limbs(const char *s, size_t n){
+	if(!n)
+		throw("ERROR");
+	bool dc = n >= DEC_CHUNK_DIGITS * max(BigIntTuning::decimal_dc_threshold, (size_t)2);
+	BigIntStats::Scope stat(BigIntStats::PARSE, (n + DEC_CHUNK_DIGITS - 1) / DEC_CHUNK_DIGITS,
+		dc ? BigIntStats::DIVIDE_CONQUER : BigIntStats::BASECASE);
+	vector<limb_t> r = decimal_to_limbs_rec(s, n);
+	BigIntStats::count_bytes(r.capacity() * sizeof(limb_t));
+	return r;
+}
+
+template<class> struct BigIntProduct;
+class BigIntBatch;
+template<size_t> class FixedBigInt;
+
+class BigInt{
+	//Sign and magnitude: little-endian base 2^64 limbs without leading zeros,
+	//where zero is empty and never negative
+	LimbStorage limbs;
+	bool negative = false;
+
+	//out = a + b, or a - b when b is taken as negative with bn = !b.negative
+	static void add_signed(BigInt &out, const BigInt &a, const BigInt &b, bool bn);
+public:
+
+	//Constructors:
+	BigInt(unsigned long long n = 0);
+	template<class T, typename enable_if<is_integral<T>::value && is_signed<T>::value, int>::type = 0>
+	BigInt(T n) : BigInt(n < 0 ? -(unsigned long long)n : (unsigned long long)n){
+		negative = n < 0;
+	}
+	BigInt(string &);
+	BigInt(const char *);
+	BigInt(string_view);
+	BigInt(const BigInt &);
+	BigInt(BigInt &&) noexcept;
+
+	//Helper Functions:
+	friend void divide_by_2(BigInt &a);
+	friend bool Null(const BigInt &);
+	friend int Length(const BigInt &);
+	int operator[](const int)const;
+
+			/* * * * Operator Overloading * * * */
+
+	//Direct assignment
+	BigInt &operator=(const BigInt &);
+	BigInt &operator=(BigInt &&);
+
+	//Post/Pre - Incrementation
+	BigInt &operator++();
+	BigInt operator++(int temp);
+	BigInt &operator--();
+	BigInt operator--(int temp);
+
+	//Addition and Subtraction; rvalue operands lend their buffer to the result
+	friend BigInt &operator+=(BigInt &, const BigInt &);
+	friend BigInt operator+(const BigInt &, const BigInt &);
+	friend BigInt operator+(BigInt &&, const BigInt &);
+	friend BigInt operator+(const BigInt &, BigInt &&);
+	friend BigInt operator+(BigInt &&, BigInt &&);
+	friend BigInt operator-(const BigInt &, const BigInt &);
+	friend BigInt operator-(BigInt &&, const BigInt &);
+	friend BigInt operator-(const BigInt &, BigInt &&);
+	friend BigInt operator-(BigInt &&, BigInt &&);
+	friend BigInt &operator-=(BigInt &, const BigInt &);
+
+	//Sign; / and % truncate toward zero like the built-in types, the floor_
+	//functions round the quotient down so the remainder takes the divisor's sign
+	friend BigInt operator-(const BigInt &);
+	friend BigInt operator-(BigInt &&);
+	friend BigInt abs(const BigInt &);
+	friend BigInt abs(BigInt &&);
+	friend int sign(const BigInt &);
+
+	//Comparison operators
+	friend bool operator==(const BigInt &, const BigInt &);
+	friend bool operator!=(const BigInt &, const BigInt &);
+
+	friend bool operator>(const BigInt &, const BigInt &);
+	friend bool operator>=(const BigInt &, const BigInt &);
+	friend bool operator<(const BigInt &, const BigInt &);
+	friend bool operator<=(const BigInt &, const BigInt &);
+
+	//Out-parameter arithmetic; out may alias an operand and keeps its buffer
+	friend void add(BigInt &, const BigInt &, const BigInt &);
+	friend void sub(BigInt &, const BigInt &, const BigInt &);
+	friend void mul(BigInt &, const BigInt &, const BigInt &);
+	friend void sqr(BigInt &, const BigInt &);
+	friend void divmod(BigInt &, BigInt &, const BigInt &, const BigInt &);
+	friend void floor_divmod(BigInt &, BigInt &, const BigInt &, const BigInt &);
+	friend void divexact(BigInt &, const BigInt &, const BigInt &);
+	friend void divexact(BigInt &, const BigInt &, unsigned long long);
+
+	//Multiplication and Division
+	friend BigInt &operator*=(BigInt &, const BigInt &);
+	friend BigInt operator*(const BigInt &, const BigInt &);
+	friend BigInt square(const BigInt &);
+	friend BigInt &operator/=(BigInt &, const BigInt &);
+	friend BigInt operator/(const BigInt &, const BigInt &);
+	friend pair<BigInt, BigInt> divmod(const BigInt &, const BigInt &);
+	friend pair<BigInt, BigInt> floor_divmod(const BigInt &, const BigInt &);
+	friend BigInt floor_div(const BigInt &, const BigInt &);
+	friend BigInt floor_mod(const BigInt &, const BigInt &);
+	friend BigInt divexact(const BigInt &, const BigInt &);
+	friend BigInt divexact(const BigInt &, unsigned long long);
+
+	//Modulo
+	friend BigInt operator%(const BigInt &, const BigInt &);
+	friend BigInt &operator%=(BigInt &, const BigInt &);
+
+	//Unsigned single limb operands: one linear pass, no temporary BigInt
+	friend BigInt &operator+=(BigInt &, unsigned long long);
+	friend BigInt &operator-=(BigInt &, unsigned long long);
+	friend BigInt &operator*=(BigInt &, unsigned long long);
+	friend BigInt &operator/=(BigInt &, unsigned long long);
+	friend BigInt &operator%=(BigInt &, unsigned long long);
+	friend BigInt operator+(const BigInt &, unsigned long long);
+	friend BigInt operator+(BigInt &&, unsigned long long);
+	friend BigInt operator+(unsigned long long, const BigInt &);
+	friend BigInt operator+(unsigned long long, BigInt &&);
+	friend BigInt operator-(const BigInt &, unsigned long long);
+	friend BigInt operator-(BigInt &&, unsigned long long);
+	friend BigInt operator*(const BigInt &, unsigned long long);
+	friend BigInt operator*(BigInt &&, unsigned long long);
+	friend BigInt operator*(unsigned long long, const BigInt &);
+	friend BigInt operator*(unsigned long long, BigInt &&);
+	friend BigInt operator/(const BigInt &, unsigned long long);
+	friend BigInt operator/(BigInt &&, unsigned long long);
+	friend BigInt operator%(const BigInt &, unsigned long long);
+	friend pair<BigInt, unsigned long long> divmod_small(const BigInt &, unsigned long long);
+
+	//Shifts and bitwise operations on the infinite two's complement form, so
+	//>> rounds down; bit_length and popcount count the bits of the magnitude
+	friend BigInt &operator<<=(BigInt &, size_t);
+	friend BigInt operator<<(const BigInt &, size_t);
+	friend BigInt &operator>>=(BigInt &, size_t);
+	friend BigInt operator>>(const BigInt &, size_t);
+	friend BigInt &operator&=(BigInt &, const BigInt &);
+	friend BigInt operator&(const BigInt &, const BigInt &);
+	friend BigInt &operator|=(BigInt &, const BigInt &);
+	friend BigInt operator|(const BigInt &, const BigInt &);
+	friend BigInt &operator^=(BigInt &, const BigInt &);
+	friend BigInt operator^(const BigInt &, const BigInt &);
+	friend size_t bit_length(const BigInt &);
+	friend bool test_bit(const BigInt &, size_t);
+	friend size_t popcount(const BigInt &);
+
+	//Power Function
+	friend BigInt pow(const BigInt &, const BigInt &);
+
+	//Roots
+	friend BigInt sqrt(const BigInt &);
+	friend pair<BigInt, BigInt> sqrtrem(const BigInt &);
+	friend BigInt nth_root(const BigInt &, unsigned long long);
+	friend bool is_perfect_square(const BigInt &);
+
+	//Greatest common divisor
+	friend class BigIntGcd;
+
+	//Read and Write
+	friend ostream &operator<<(ostream &,const BigInt &);
+	friend istream &operator>>(istream &, BigInt &);
+	friend from_chars_result from_chars(const char *, const char *, BigInt &);
+	friend to_chars_result to_chars(char *, char *, const BigInt &);
+	friend size_t write_to(FILE *, const BigInt &);
+	friend size_t write_to(int, const BigInt &);
+
+	//Binary serialization
+	friend size_t serialized_size(const BigInt &);
+	friend size_t serialize(char *, const BigInt &);
+	friend ostream &serialize(ostream &, const BigInt &);
+	friend size_t deserialize(const char *, size_t, BigInt &);
+	friend istream &deserialize(istream &, BigInt &);
+	friend class BigIntView;
+
+	//Lazy expressions, see lazy()
+	friend size_t operand_limbs(const BigInt &, const limb_t *&);
+	friend bool operand_negative(const BigInt &);
+	template<class> friend struct BigIntProduct;
+	template<class, class> friend struct BigIntMulAdd;
+	template<class Rhs> friend BigInt &operator+=(BigInt &, const BigIntProduct<Rhs> &);
+	template<class Rhs> friend BigInt operator%(const BigIntProduct<Rhs> &, const BigInt &);
+
+	//Modular arithmetic
+	friend class ModContext;
+
+	//Batch arithmetic
+	friend class BigIntBatch;
+
+	//Fixed-width integers
+	template<size_t> friend class FixedBigInt;
+
+	//Others
+	friend BigInt NthCatalan(unsigned long long n);
+	friend BigInt NthFibonacci(unsigned long long n);
+	friend pair<BigInt, BigInt> NthFibonacciPair(unsigned long long n);
+	friend BigInt NthLucas(unsigned long long n);
+	friend pair<BigInt, BigInt> NthLucasPair(unsigned long long n);
+	friend BigInt Factorial(unsigned long long n);
+	friend BigInt Factorial(unsigned long long n, unsigned threads);
+	friend BigInt Binomial(unsigned long long n, unsigned long long k);
+	friend BigInt Binomial(unsigned long long n, unsigned long long k, unsigned threads);
+};
+
+//Skips a leading minus sign of s[0..n) and reports whether there was one
+inline bool decimal_skip_sign(const char *&s, size_t &n){
+	if(!n || *s != '-')
+		return false;
+	s++;
+	n--;
+	return true;
+}
+
+inline BigInt::BigInt(string & s) : BigInt(string_view(s)){
+}
+inline BigInt::BigInt(unsigned long long nr){
+	if(nr)
+		limbs.push_back(nr);
+}
+inline BigInt::BigInt(const char *s) : BigInt(string_view(s)){
+}
+inline BigInt::BigInt(string_view s){
+	const char *p = s.data();
+	size_t n = s.size();
+	bool neg = decimal_skip_sign(p, n);
+	limbs = decimal_to_limbs(p, n);
+	negative = neg && !limbs.empty();
+}
+inline BigInt::BigInt(const BigInt & a){
+	limbs = a.limbs;
+	negative = a.negative;
+}
+inline BigInt::BigInt(BigInt && a) noexcept : limbs(move(a.limbs)), negative(a.negative){
+	a.negative = false;
+}
+
+inline bool Null(const BigInt& a){
+	return a.limbs.empty();
+}
+//Number of decimal digits of the magnitude. The bit length leaves two
+//candidates and one power of ten decides, so a call costs about one
+//multiplication rather than a conversion; to visit many digits, print the
+//value once with << or to_chars and index the text instead.
+inline int Length(const BigInt & a){
+	size_t n = a.limbs.size();
+	if(n <= 1){
+		limb_t x = n ? a.limbs[0] : 0;
+		int d = 1;
+		for (; x >= 10; x /= 10)
+			d++;
+		return d;
+	}
+	//10^(d - 1) <= 2^(bits - 1) <= |a|, so d is the count or one short of it
+	size_t bits = 64 * n - __builtin_clzll(a.limbs[n - 1]);
+	size_t d = (size_t)((bits - 1) * 0.30102999566398) + 1;
+	BigInt p = pow(BigInt(10), BigInt((unsigned long long)d));
+	for (; limbs_cmp(a.limbs.data(), n, p.limbs.data(), p.limbs.size()) >= 0; p *= 10)
+		d++;
+	return d;
+}
+//Decimal digit of the magnitude at position index, counted from the least
+//significant one. Like Length() this is one division by a power of ten per
+//call, not a loop body for reading every digit.
+inline int BigInt::operator[](const int index)const{
+	if(index < 0)
+		throw("ERROR");
+	BigInt q = abs(*this);
+	if(index){
+		BigInt r;
+		divmod(q, r, q, pow(BigInt(10), BigInt((unsigned long long)index)));
+		if(q.limbs.empty())
+			throw("ERROR");
+	}
+	return divmod_small(q, 10).second;
+}
+inline bool operator==(const BigInt &a, const BigInt &b){
+	return a.negative == b.negative && a.limbs == b.limbs;
+}
+inline bool operator!=(const BigInt & a,const BigInt &b){
+	return !(a == b);
+}
+inline bool operator<(const BigInt&a,const BigInt&b){
+	if(a.negative != b.negative)
+		return a.negative;
+	//Both negative: the larger magnitude is the smaller number
+	const BigInt &x = a.negative ? b : a, &y = a.negative ? a : b;
+	size_t n = x.limbs.size(), m = y.limbs.size();
+	if(n != m)
+		return n < m;
+	if(n == 1)
+		return x.limbs[0] < y.limbs[0];
+	return limbs_cmp(x.limbs.data(), n, y.limbs.data(), m) < 0;
+}
+inline bool operator>(const BigInt&a,const BigInt&b){
+	return b < a;
+}
+inline bool operator>=(const BigInt&a,const BigInt&b){
+	return !(a < b);
+}
+inline bool operator<=(const BigInt&a,const BigInt&b){
+	return !(a > b);
+}
+
+inline BigInt &BigInt::operator=(const BigInt &a){
+	limbs = a.limbs;
+	negative = a.negative;
+	return *this;
+}
+inline BigInt &BigInt::operator=(BigInt &&a){
+	if(this != &a){
+		limbs = move(a.limbs);
+		negative = a.negative;
+		a.limbs.clear();
+		a.negative = false;
+	}
+	return *this;
+}
+
+//Magnitude steps of ++ and --; v must be nonzero to be decremented
+inline void limbs_increment(LimbStorage &v){
+	if(!v.empty() && v[0] != ~(limb_t)0){
+		v[0]++;
+		return;
+	}
+	size_t i, n = v.size();
+	for (i = 0; i < n && v[i] == ~(limb_t)0;i++)
+		v[i] = 0;
+	if(i == n)
+		v.push_back(1);
+	else
+		v[i]++;
+}
+inline void limbs_decrement(LimbStorage &v){
+	if(v[0]){
+		if(!--v[0] && v.size() == 1)
+			v.pop_back();
+		return;
+	}
+	size_t i, n = v.size();
+	for (i = 0; v[i] == 0;i++)
+		v[i] = ~(limb_t)0;
+	v[i]--;
+	if(!v[n - 1])
+		v.pop_back();
+}
+
+inline BigInt &BigInt::operator++(){
+	if(negative){
+		limbs_decrement(limbs);
+		negative = !limbs.empty();
+	}
+	else
+		limbs_increment(limbs);
+	return *this;
+}
+inline BigInt BigInt::operator++(int temp){
+	BigInt aux(*this);
+	++(*this);
+	return aux;
+}
+
+inline BigInt &BigInt::operator--(){
+	if(negative || limbs.empty()){
+		limbs_increment(limbs);
+		negative = true;
+	}
+	else
+		limbs_decrement(limbs);
+	return *this;
+}
+inline BigInt BigInt::operator--(int temp){
+	BigInt aux(*this);
+	--(*this);
+	return aux;
+}
+
+//Scratch limbs for the out-parameter functions when out aliases an operand
+inline vector<limb_t> &scratch_limbs(){
+	thread_local vector<limb_t> scratch;
+	return scratch;
+}
+
+//Magnitudes of equal sign are added; otherwise the shorter one is subtracted
+//from the longer in one pass that also yields the sign of the difference
+inline void BigInt::add_signed(BigInt &out, const BigInt &a, const BigInt &b, bool bn){
+	bool swapped = a.limbs.size() < b.limbs.size();
+	const BigInt &x = swapped ? b : a, &y = swapped ? a : b;
+	bool xn = swapped ? bn : a.negative, yn = swapped ? a.negative : bn;
+	size_t n = x.limbs.size(), m = y.limbs.size();
+	//The kernels read each limb of y before writing the same limb of out
+	if(xn != yn){
+		out.limbs.resize(n);
+		xn ^= limbs_sub_abs(out.limbs.data(), x.limbs.data(), n, y.limbs.data(), m);
+		limbs_trim(out.limbs);
+		out.negative = xn && !out.limbs.empty();
+		return;
+	}
+	out.negative = xn && n;
+	if(n == 1 && m == 1){
+		limb_t l = y.limbs[0], s = x.limbs[0] + l;
+		out.limbs.resize(1);
+		out.limbs[0] = s;
+		if(s < l)
+			out.limbs.push_back(1);
+		return;
+	}
+	out.limbs.resize(n);
+	limb_t c = limbs_add(out.limbs.data(), x.limbs.data(), n, y.limbs.data(), m);
+	if(c)
+		out.limbs.push_back(c);
+}
+//out = a + b; out may be a or b and keeps its buffer
+inline void add(BigInt &out, const BigInt &a, const BigInt &b){
+	BigInt::add_signed(out, a, b, b.negative);
+}
+//out = a - b; out may be a or b and keeps its buffer
+inline void sub(BigInt &out, const BigInt &a, const BigInt &b){
+	BigInt::add_signed(out, a, b, !b.negative);
+}
+//out = a * b; out may be a or b and keeps its buffer
+inline void mul(BigInt &out, const BigInt &a, const BigInt &b){
+	const BigInt &x = a.limbs.size() >= b.limbs.size() ? a : b, &y = &x == &a ? b : a;
+	size_t n = x.limbs.size(), m = y.limbs.size();
+	if(!m){
+		out.limbs.clear();
+		out.negative = false;
+		return;
+	}
+	out.negative = a.negative != b.negative;
+	BigIntStats::Scope stat(BigIntStats::MUL, m, m == 1 ? BigIntStats::SINGLE_LIMB :
+		&x == &y ? limbs_sqr_tier(n) : limbs_mul_tier(n, m));
+	//A single-limb factor is applied in place
+	if(m == 1){
+		limb_t l = y.limbs[0];
+		out.limbs.resize(n);
+		limb_t c = limbs_mul_1(out.limbs.data(), x.limbs.data(), n, l);
+		if(c)
+			out.limbs.push_back(c);
+		return;
+	}
+	if(&out == &a || &out == &b){
+		vector<limb_t> &t = scratch_limbs();
+		t.resize(n + m);
+		limbs_mul(t.data(), x.limbs.data(), n, y.limbs.data(), m);
+		out.limbs.assign(t.data(), limbs_normalized_size(t.data(), n + m));
+		return;
+	}
+	out.limbs.resize(n + m);
+	limbs_mul(out.limbs.data(), x.limbs.data(), n, y.limbs.data(), m);
+	limbs_trim(out.limbs);
+}
+//out = a * a; out may be a and keeps its buffer
+inline void sqr(BigInt &out, const BigInt &a){
+	size_t n = a.limbs.size();
+	out.negative = false;
+	if(!n){
+		out.limbs.clear();
+		return;
+	}
+	BigIntStats::Scope stat(BigIntStats::SQR, n, limbs_sqr_tier(n));
+	if(&out == &a){
+		vector<limb_t> &t = scratch_limbs();
+		t.resize(2 * n);
+		limbs_sqr(t.data(), a.limbs.data(), n);
+		out.limbs.assign(t.data(), limbs_normalized_size(t.data(), 2 * n));
+		return;
+	}
+	out.limbs.resize(2 * n);
+	limbs_sqr(out.limbs.data(), a.limbs.data(), n);
+	limbs_trim(out.limbs);
+}
+//q = a / b rounded toward zero and r = a - qb, which takes the sign of a;
+//q and r must differ but either may be a or b
+inline void divmod(BigInt &q, BigInt &r, const BigInt &a, const BigInt &b){
+	if(Null(b))
+		throw("Arithmetic Error: Division By 0");
+	if(&q == &r)
+		throw("ERROR");
+	size_t n = a.limbs.size(), m = b.limbs.size();
+	bool qn = a.negative != b.negative, rn = a.negative;
+	if(limbs_cmp(a.limbs.data(), n, b.limbs.data(), m) < 0){
+		r = a;
+		q.limbs.clear();
+		q.negative = false;
+		return;
+	}
+	BigIntStats::Scope stat(BigIntStats::DIV, m, limbs_divrem_tier(n, m));
+	const limb_t *x = a.limbs.data(), *y = b.limbs.data();
+	if(&q == &a || &q == &b || &r == &a || &r == &b){
+		vector<limb_t> &t = scratch_limbs();
+		t.assign(x, x + n);
+		t.insert(t.end(), y, y + m);
+		x = t.data();
+		y = x + n;
+	}
+	q.limbs.resize(n - m + 1);
+	r.limbs.resize(m);
+	limbs_divrem(q.limbs.data(), r.limbs.data(), x, n, y, m);
+	limbs_trim(q.limbs);
+	limbs_trim(r.limbs);
+	q.negative = qn;
+	r.negative = rn && !r.limbs.empty();
+}
+//q = floor(a / b) and r = a - qb, which takes the sign of b
+inline void floor_divmod(BigInt &q, BigInt &r, const BigInt &a, const BigInt &b){
+	BigInt t;
+	const BigInt &d = &b == &q || &b == &r ? (t = b) : b;
+	divmod(q, r, a, d);
+	if(r.negative != d.negative && !r.limbs.empty()){
+		--q;
+		r += d;
+	}
+}
+
+//q = a / b for a b known to divide a, without computing a remainder; the
+//result is unspecified when b does not divide a. q may be a or b.
+inline void divexact(BigInt &q, const BigInt &a, const BigInt &b){
+	if(Null(b))
+		throw("Arithmetic Error: Division By 0");
+	size_t n = a.limbs.size(), m = b.limbs.size();
+	bool qn = a.negative != b.negative;
+	if(m == 1){
+		divexact(q, a, b.limbs[0]);
+		q.negative = qn && !q.limbs.empty();
+		return;
+	}
+	if(n < m){
+		q.limbs.clear();
+		q.negative = false;
+		return;
+	}
+	//The Hensel step needs an odd divisor, so common factors of two go first
+	if(!(b.limbs[0] & 1)){
+		size_t t = 0;
+		while(!b.limbs[t / 64])
+			t += 64;
+		t += __builtin_ctzll(b.limbs[t / 64]);
+		divexact(q, a >> t, b >> t);
+		return;
+	}
+	if(min(n - m + 1, m) >= BigIntTuning::divide_bz_threshold){
+		BigInt r;
+		divmod(q, r, a, b);
+		return;
+	}
+	vector<limb_t> &u = scratch_limbs();
+	u.assign(a.limbs.data(), a.limbs.data() + n);
+	u.insert(u.end(), b.limbs.data(), b.limbs.data() + m);
+	q.limbs.resize(n - m + 1);
+	limbs_divexact(q.limbs.data(), u.data(), n, u.data() + n, m);
+	limbs_trim(q.limbs);
+	q.negative = qn && !q.limbs.empty();
+}
+inline void divexact(BigInt &q, const BigInt &a, unsigned long long d){
+	if(!d)
+		throw("Arithmetic Error: Division By 0");
+	size_t n = a.limbs.size();
+	q.negative = a.negative;
+	q.limbs.resize(n);
+	limbs_divexact_1(q.limbs.data(), a.limbs.data(), n, d);
+	limbs_trim(q.limbs);
+	q.negative = q.negative && !q.limbs.empty();
+}
+
+inline BigInt &operator+=(BigInt &a,const BigInt& b){
+	add(a, a, b);
+	return a;
+}
+inline BigInt operator+(const BigInt &a, const BigInt &b){
+	BigInt temp;
+	add(temp, a, b);
+	return temp;
+}
+inline BigInt operator+(BigInt &&a, const BigInt &b){
+	add(a, a, b);
+	return move(a);
+}
+inline BigInt operator+(const BigInt &a, BigInt &&b){
+	add(b, a, b);
+	return move(b);
+}
+inline BigInt operator+(BigInt &&a, BigInt &&b){
+	add(a, a, b);
+	return move(a);
+}
+
+inline BigInt &operator-=(BigInt&a,const BigInt &b){
+	sub(a, a, b);
+	return a;
+}
+inline BigInt operator-(const BigInt& a,const BigInt&b){
+	BigInt temp;
+	sub(temp, a, b);
+	return temp;
+}
+inline BigInt operator-(BigInt &&a, const BigInt &b){
+	sub(a, a, b);
+	return move(a);
+}
+inline BigInt operator-(const BigInt &a, BigInt &&b){
+	sub(b, a, b);
+	return move(b);
+}
+inline BigInt operator-(BigInt &&a, BigInt &&b){
+	sub(a, a, b);
+	return move(a);
+}
+
+inline BigInt operator-(const BigInt &a){
+	BigInt temp(a);
+	temp.negative = !a.negative && !a.limbs.empty();
+	return temp;
+}
+inline BigInt operator-(BigInt &&a){
+	a.negative = !a.negative && !a.limbs.empty();
+	return move(a);
+}
+inline BigInt abs(const BigInt &a){
+	BigInt temp(a);
+	temp.negative = false;
+	return temp;
+}
+inline BigInt abs(BigInt &&a){
+	a.negative = false;
+	return move(a);
+}
+//-1, 0 or 1 as a is negative, zero or positive
+inline int sign(const BigInt &a){
+	return a.negative ? -1 : !a.limbs.empty();
+}
+
+inline BigInt &operator*=(BigInt &a, const BigInt &b){
+	mul(a, a, b);
+	return a;
+}
+inline BigInt operator*(const BigInt&a,const BigInt&b){
+	BigInt temp;
+	mul(temp, a, b);
+	return temp;
+}
+inline BigInt square(const BigInt &a){
+	BigInt temp;
+	sqr(temp, a);
+	return temp;
+}
+
+//Quotient and remainder from a single long division
+inline pair<BigInt, BigInt> divmod(const BigInt &a, const BigInt &b){
+	pair<BigInt, BigInt> res;
+	divmod(res.first, res.second, a, b);
+	return res;
+}
+inline pair<BigInt, BigInt> floor_divmod(const BigInt &a, const BigInt &b){
+	pair<BigInt, BigInt> res;
+	floor_divmod(res.first, res.second, a, b);
+	return res;
+}
+inline BigInt floor_div(const BigInt &a, const BigInt &b){
+	return floor_divmod(a, b).first;
+}
+//a mod b in [0, b) for b > 0 and in (b, 0] for b < 0
+inline BigInt floor_mod(const BigInt &a, const BigInt &b){
+	return floor_divmod(a, b).second;
+}
+
+inline BigInt divexact(const BigInt &a, const BigInt &b){
+	BigInt q;
+	divexact(q, a, b);
+	return q;
+}
+inline BigInt divexact(const BigInt &a, unsigned long long d){
+	BigInt q;
+	divexact(q, a, d);
+	return q;
+}
+
+inline BigInt &operator/=(BigInt& a,const BigInt &b){
+	BigInt r;
+	divmod(a, r, a, b);
+	return a;
+}
+inline BigInt operator/(const BigInt &a,const BigInt &b){
+	return divmod(a, b).first;
+}
+
+inline BigInt &operator%=(BigInt& a,const BigInt &b){
+	BigInt q;
+	divmod(q, a, a, b);
+	return a;
+}
+inline BigInt operator%(const BigInt &a,const BigInt &b){
+	return divmod(a, b).second;
+}
+
+//Magnitude steps of the single limb + and -: v += l, and v = |v - l|
+//returning whether l > v
+inline void limbs_add_1(LimbStorage &v, limb_t l){
+	if(v.empty()){
+		if(l)
+			v.push_back(l);
+	}
+	else if(limbs_add(v.data(), v.data(), v.size(), &l, 1))
+		v.push_back(1);
+}
+inline bool limbs_sub_1_abs(LimbStorage &v, limb_t l){
+	if(v.size() <= 1 && (v.empty() ? 0 : v[0]) < l){
+		limb_t d = l - (v.empty() ? 0 : v[0]);
+		v.resize(1);
+		v[0] = d;
+		return true;
+	}
+	if(l){
+		limbs_sub(v.data(), v.data(), v.size(), &l, 1);
+		limbs_trim(v);
+	}
+	return false;
+}
+
+inline BigInt &operator+=(BigInt &a, unsigned long long b){
+	if(a.negative)
+		a.negative = !limbs_sub_1_abs(a.limbs, b) && !a.limbs.empty();
+	else
+		limbs_add_1(a.limbs, b);
+	return a;
+}
+inline BigInt &operator-=(BigInt &a, unsigned long long b){
+	if(a.negative)
+		limbs_add_1(a.limbs, b);
+	else
+		a.negative = limbs_sub_1_abs(a.limbs, b);
+	return a;
+}
+inline BigInt &operator*=(BigInt &a, unsigned long long b){
+	if(!b){
+		a.limbs.clear();
+		a.negative = false;
+		return a;
+	}
+	limb_t c = limbs_mul_1(a.limbs.data(), a.limbs.data(), a.limbs.size(), b);
+	if(c)
+		a.limbs.push_back(c);
+	return a;
+}
+inline BigInt &operator/=(BigInt &a, unsigned long long b){
+	if(!b)
+		throw("Arithmetic Error: Division By 0");
+	limbs_divrem_1(a.limbs.data(), a.limbs.data(), a.limbs.size(), b);
+	limbs_trim(a.limbs);
+	a.negative = a.negative && !a.limbs.empty();
+	return a;
+}
+inline BigInt &operator%=(BigInt &a, unsigned long long b){
+	if(!b)
+		throw("Arithmetic Error: Division By 0");
+	limb_t r = limbs_divrem_1(nullptr, a.limbs.data(), a.limbs.size(), b);
+	a.limbs.clear();
+	if(r)
+		a.limbs.push_back(r);
+	a.negative = a.negative && r;
+	return a;
+}
+inline BigInt operator+(const BigInt &a, unsigned long long b){
+	BigInt temp;
+	limb_t l = b;
+	size_t n = a.limbs.size();
+	if(!n)
+		return BigInt(b);
+	if(a.negative){
+		temp = a;
+		temp += b;
+		return temp;
+	}
+	temp.limbs.resize(n + 1);
+	temp.limbs[n] = limbs_add(temp.limbs.data(), a.limbs.data(), n, &l, 1);
+	limbs_trim(temp.limbs);
+	return temp;
+}
+inline BigInt operator+(BigInt &&a, unsigned long long b){
+	a += b;
+	return move(a);
+}
+inline BigInt operator+(unsigned long long a, const BigInt &b){
+	return b + a;
+}
+inline BigInt operator+(unsigned long long a, BigInt &&b){
+	b += a;
+	return move(b);
+}
+inline BigInt operator-(const BigInt &a, unsigned long long b){
+	BigInt temp(a);
+	temp -= b;
+	return temp;
+}
+inline BigInt operator-(BigInt &&a, unsigned long long b){
+	a -= b;
+	return move(a);
+}
+inline BigInt operator*(const BigInt &a, unsigned long long b){
+	BigInt temp;
+	size_t n = a.limbs.size();
+	if(!n || !b)
+		return temp;
+	temp.limbs.resize(n + 1);
+	temp.limbs[n] = limbs_mul_1(temp.limbs.data(), a.limbs.data(), n, b);
+	limbs_trim(temp.limbs);
+	temp.negative = a.negative;
+	return temp;
+}
+inline BigInt operator*(BigInt &&a, unsigned long long b){
+	a *= b;
+	return move(a);
+}
+inline BigInt operator*(unsigned long long a, const BigInt &b){
+	return b * a;
+}
+inline BigInt operator*(unsigned long long a, BigInt &&b){
+	b *= a;
+	return move(b);
+}
+inline BigInt operator/(const BigInt &a, unsigned long long b){
+	return divmod_small(a, b).first;
+}
+inline BigInt operator/(BigInt &&a, unsigned long long b){
+	a /= b;
+	return move(a);
+}
+inline BigInt operator%(const BigInt &a, unsigned long long b){
+	if(!b)
+		throw("Arithmetic Error: Division By 0");
+	BigInt r(limbs_divrem_1(nullptr, a.limbs.data(), a.limbs.size(), b));
+	r.negative = a.negative && !r.limbs.empty();
+	return r;
+}
+//Truncated quotient and the remainder of the magnitude, so that
+//a = first * b + second for a >= 0 and a = first * b - second for a < 0
+inline pair<BigInt, unsigned long long> divmod_small(const BigInt &a, unsigned long long b){
+	if(!b)
+		throw("Arithmetic Error: Division By 0");
+	pair<BigInt, unsigned long long> res;
+	size_t n = a.limbs.size();
+	res.first.limbs.resize(n);
+	res.second = limbs_divrem_1(res.first.limbs.data(), a.limbs.data(), n, b);
+	limbs_trim(res.first.limbs);
+	res.first.negative = a.negative && !res.first.limbs.empty();
+	return res;
+}
+
+//Signed scalar operands take the single limb path on their magnitude, so that
+//x * -3 is not read as x * (2^64 - 3); the sign is applied around it
+template<class T>
+using enable_if_signed_t = typename enable_if<is_integral<T>::value && is_signed<T>::value, int>::type;
+template<class T>
+unsigned long long scalar_magnitude(T n){
+	return n < 0 ? -(unsigned long long)n : (unsigned long long)n;
+}
+
+template<class T, enable_if_signed_t<T> = 0>
+BigInt &operator+=(BigInt &a, T b){
+	return b < 0 ? a -= scalar_magnitude(b) : a += scalar_magnitude(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt &operator-=(BigInt &a, T b){
+	return b < 0 ? a += scalar_magnitude(b) : a -= scalar_magnitude(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt &operator*=(BigInt &a, T b){
+	a *= scalar_magnitude(b);
+	if(b < 0)
+		a = -move(a);
+	return a;
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt &operator/=(BigInt &a, T b){
+	a /= scalar_magnitude(b);
+	if(b < 0)
+		a = -move(a);
+	return a;
+}
+//The remainder takes the sign of a, as for BigInt operands
+template<class T, enable_if_signed_t<T> = 0>
+BigInt &operator%=(BigInt &a, T b){
+	return a %= scalar_magnitude(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator+(const BigInt &a, T b){
+	return b < 0 ? a - scalar_magnitude(b) : a + scalar_magnitude(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator+(BigInt &&a, T b){
+	a += b;
+	return move(a);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator+(T a, const BigInt &b){
+	return b + a;
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator+(T a, BigInt &&b){
+	b += a;
+	return move(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator-(const BigInt &a, T b){
+	return b < 0 ? a + scalar_magnitude(b) : a - scalar_magnitude(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator-(BigInt &&a, T b){
+	a -= b;
+	return move(a);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator*(const BigInt &a, T b){
+	BigInt temp = a * scalar_magnitude(b);
+	if(b < 0)
+		temp = -move(temp);
+	return temp;
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator*(BigInt &&a, T b){
+	a *= b;
+	return move(a);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator*(T a, const BigInt &b){
+	return b * a;
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator*(T a, BigInt &&b){
+	b *= a;
+	return move(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator/(const BigInt &a, T b){
+	BigInt temp = a / scalar_magnitude(b);
+	if(b < 0)
+		temp = -move(temp);
+	return temp;
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator/(BigInt &&a, T b){
+	a /= b;
+	return move(a);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt operator%(const BigInt &a, T b){
+	return a % scalar_magnitude(b);
+}
+template<class T, enable_if_signed_t<T> = 0>
+void divexact(BigInt &q, const BigInt &a, T d){
+	divexact(q, a, scalar_magnitude(d));
+	if(d < 0)
+		q = -move(q);
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigInt divexact(const BigInt &a, T d){
+	BigInt q = divexact(a, scalar_magnitude(d));
+	if(d < 0)
+		q = -move(q);
+	return q;
+}
+
+inline BigInt &operator<<=(BigInt &a, size_t s){
+	size_t n = a.limbs.size(), k = s / 64;
+	if(!n)
+		return a;
+	a.limbs.resize(n + k + 1);
+	limb_t *r = a.limbs.data();
+	r[n] = limbs_lshift(r, r, n, s % 64);
+	copy_backward(r, r + n + 1, r + n + k + 1);
+	fill(r, r + k, 0);
+	limbs_trim(a.limbs);
+	return a;
+}
+inline BigInt operator<<(const BigInt &a, size_t s){
+	BigInt temp(a);
+	temp <<= s;
+	return temp;
+}
+//Rounds down, so a negative a that loses one bits moves one further from zero
+inline BigInt &operator>>=(BigInt &a, size_t s){
+	size_t n = a.limbs.size(), k = s / 64;
+	bool inexact = false;
+	if(a.negative){
+		for (size_t i = 0; i < min(k, n) && !inexact; i++)
+			inexact = a.limbs[i];
+		inexact = inexact || (k < n && a.limbs[k] << (63 - s % 64) << 1);
+	}
+	if(k >= n)
+		a.limbs.clear();
+	else{
+		limbs_rshift(a.limbs.data(), a.limbs.data() + k, n - k, s % 64);
+		a.limbs.resize(n - k);
+		limbs_trim(a.limbs);
+	}
+	if(inexact)
+		limbs_increment(a.limbs);
+	return a;
+}
+inline BigInt operator>>(const BigInt &a, size_t s){
+	BigInt temp(a);
+	temp >>= s;
+	return temp;
+}
+
+//a = a op b on the two's complement forms of the signed magnitudes a, an and
+//b, bn, each negated on the fly as ~x + 1; returns the sign of the result
+template<class Op>
+inline bool limbs_bitwise(LimbStorage &a, bool an, const LimbStorage &b, bool bn, Op op){
+	bool rn = op(an ? ~(limb_t)0 : 0, bn ? ~(limb_t)0 : 0) >> 63;
+	size_t m = b.size(), n = max(a.size(), m) + 1;
+	a.resize(n);
+	limb_t ca = an, cb = bn, cr = rn;
+	for (size_t i = 0; i < n; i++){
+		limb_t x = a[i], y = i < m ? b[i] : 0;
+		if(an){
+			x = ~x + ca;
+			ca &= x == 0;
+		}
+		if(bn){
+			y = ~y + cb;
+			cb &= y == 0;
+		}
+		limb_t v = op(x, y);
+		if(rn){
+			v = ~v + cr;
+			cr &= v == 0;
+		}
+		a[i] = v;
+	}
+	limbs_trim(a);
+	return rn && !a.empty();
+}
+
+inline BigInt &operator&=(BigInt &a, const BigInt &b){
+	if(a.negative || b.negative){
+		a.negative = limbs_bitwise(a.limbs, a.negative, b.limbs, b.negative, [](limb_t x, limb_t y){ return x & y; });
+		return a;
+	}
+	size_t n = min(a.limbs.size(), b.limbs.size());
+	a.limbs.resize(n);
+	for (size_t i = 0; i < n; i++)
+		a.limbs[i] &= b.limbs[i];
+	limbs_trim(a.limbs);
+	return a;
+}
+inline BigInt operator&(const BigInt &a, const BigInt &b){
+	BigInt temp(a);
+	temp &= b;
+	return temp;
+}
+inline BigInt &operator|=(BigInt &a, const BigInt &b){
+	if(a.negative || b.negative){
+		a.negative = limbs_bitwise(a.limbs, a.negative, b.limbs, b.negative, [](limb_t x, limb_t y){ return x | y; });
+		return a;
+	}
+	size_t m = b.limbs.size();
+	if(a.limbs.size() < m)
+		a.limbs.resize(m);
+	for (size_t i = 0; i < m; i++)
+		a.limbs[i] |= b.limbs[i];
+	return a;
+}
+inline BigInt operator|(const BigInt &a, const BigInt &b){
+	BigInt temp(a);
+	temp |= b;
+	return temp;
+}
+inline BigInt &operator^=(BigInt &a, const BigInt &b){
+	if(a.negative || b.negative){
+		a.negative = limbs_bitwise(a.limbs, a.negative, b.limbs, b.negative, [](limb_t x, limb_t y){ return x ^ y; });
+		return a;
+	}
+	size_t m = b.limbs.size();
+	if(a.limbs.size() < m)
+		a.limbs.resize(m);
+	for (size_t i = 0; i < m; i++)
+		a.limbs[i] ^= b.limbs[i];
+	limbs_trim(a.limbs);
+	return a;
+}
+inline BigInt operator^(const BigInt &a, const BigInt &b){
+	BigInt temp(a);
+	temp ^= b;
+	return temp;
+}
+
+//Number of bits of the magnitude without leading zeros, 0 for zero
+inline size_t bit_length(const BigInt &a){
+	size_t n = a.limbs.size();
+	return n ? 64 * n - __builtin_clzll(a.limbs[n - 1]) : 0;
+}
+//Bit i of the two's complement form, counted from the least significant one.
+//Negating keeps the bits up to the lowest one bit and inverts those above it.
+inline bool test_bit(const BigInt &a, size_t i){
+	bool bit = i / 64 < a.limbs.size() && (a.limbs[i / 64] >> (i % 64) & 1);
+	if(!a.negative)
+		return bit;
+	size_t low = 0;
+	while(!a.limbs[low / 64])
+		low += 64;
+	low += __builtin_ctzll(a.limbs[low / 64]);
+	return i > low ? !bit : bit;
+}
+//Number of one bits of the magnitude
+inline size_t popcount(const BigInt &a){
+	size_t c = 0;
+	for (size_t i = 0; i < a.limbs.size(); i++)
+		c += __builtin_popcountll(a.limbs[i]);
+	return c;
+}
+
+//base^exp by left-to-right binary exponentiation over the bits of exp >= 0
+inline BigInt pow(const BigInt &base, const BigInt &exp){
+	if(exp.negative)
+		throw("ERROR");
+	BigInt r(1);
+	for (size_t i = bit_length(exp); i--;){
+		sqr(r, r);
+		if(test_bit(exp, i))
+			r *= base;
+	}
+	return r;
+}
+
+inline void divide_by_2(BigInt & a){
+	a >>= 1;
+}
+
+//floor(sqrt(a)) by Newton's iteration at doubling precision: each step takes
+//the root of the top 2d bits from that of the top d bits with one division,
+//so the cost is that of the last, full size, division
+inline BigInt sqrt(const BigInt &a){
+	if(a.negative)
+		throw("ERROR");
+	if(Null(a))
+		return BigInt();
+	size_t c = (bit_length(a) - 1) / 2, d = 0;
+	BigInt x(1);
+	for (int s = c ? 63 - __builtin_clzll(c) : -1; s >= 0; s--){
+		size_t e = d;
+		d = c >> s;
+		x = (x << (d - e - 1)) + (a >> (2 * c - e - d + 1)) / x;
+	}
+	if(square(x) > a)
+		--x;
+	return x;
+}
+//Root and remainder a - root^2
+inline pair<BigInt, BigInt> sqrtrem(const BigInt &a){
+	pair<BigInt, BigInt> res;
+	res.first = sqrt(a);
+	sub(res.second, a, square(res.first));
+	return res;
+}
+//floor(a^(1/k)) by Newton's iteration, which decreases monotonically to the
+//root from any starting value above it. Large roots start from the root of
+//the top half of the bits, so only the last one or two steps are full size.
+//Odd roots of a negative a are those of the magnitude, negated.
+inline BigInt nth_root(const BigInt &a, unsigned long long k){
+	if(!k || (a.negative && !(k & 1)))
+		throw("ERROR");
+	if(k == 1 || Null(a))
+		return a;
+	if(a.negative)
+		return -nth_root(abs(a), k);
+	if(k == 2)
+		return sqrt(a);
+	size_t bits = bit_length(a);
+	if(k >= bits)
+		return BigInt(1);
+	size_t s = bits / k / 2;
+	//a < (r + 1)^k * 2^(ks) for r the root of a >> ks
+	BigInt x = s < 64 ? BigInt(1) << ((bits + k - 1) / k) : (nth_root(a >> (k * s), k) + 1) << s;
+	while(true){
+		BigInt y = (x * (k - 1) + a / pow(x, k - 1)) / k;
+		if(y >= x)
+			return x;
+		x = move(y);
+	}
+}
+//Whether a is a perfect square; most non-squares are rejected by their residues
+//modulo 64, 63, 65 and 11 before any root is taken
+inline bool is_perfect_square(const BigInt &a){
+	if(a.negative)
+		return false;
+	if(Null(a))
+		return true;
+	//Bit i is set when i is a square modulo 64
+	if(!(0x202021202030213ULL >> (a.limbs[0] & 63) & 1))
+		return false;
+	static const array<bitset<65>, 3> residues = [](){
+		array<bitset<65>, 3> t;
+		for (unsigned i = 0; i < 65; i++)
+			t[0][i * i % 63] = t[1][i * i % 65] = t[2][i * i % 11] = 1;
+		return t;
+	}();
+	unsigned long long r = divmod_small(a, 63 * 65 * 11).second;
+	if(!residues[0][r % 63] || !residues[1][r % 65] || !residues[2][r % 11])
+		return false;
+	return Null(sqrtrem(a).second);
+}
+
+//Binary gcd of operands of up to two limbs
+inline unsigned gcd_ctz(limb_t a){
+	return __builtin_ctzll(a);
+}
+inline unsigned gcd_ctz(dlimb_t a){
+	return (limb_t)a ? __builtin_ctzll((limb_t)a) : 64 + __builtin_ctzll((limb_t)(a >> 64));
+}
+template<class T>
+inline T binary_gcd(T a, T b){
+	if(!a || !b)
+		return a | b;
+	unsigned k = gcd_ctz(a | b);
+	a >>= gcd_ctz(a);
+	do{
+		b >>= gcd_ctz(b);
+		if(a > b)
+			swap(a, b);
+		b -= a;
+	}while(b);
+	return a << k;
+}
+
+//Euclid's algorithm on a pair x >= y, carried out in as few full size steps as
+//possible: binary gcd once both fit in two limbs, Lehmer steps that take about
+//31 bits of quotients from the top limbs at a time, and above hgcd_threshold
+//limbs the half-gcd, which finds the quotients that halve the pair from its
+//top half recursively, in the form of Moller, "On Schonhage's algorithm and
+//subquadratic integer gcd computation", 2008. Every step is recorded as a
+//matrix M with (x; y) = M (x'; y') for the pair before and after it.
+class BigIntGcd{
+	//Nonnegative entries and determinant (-1)^odd. The extended gcd needs only
+	//the second row, rows above first are left alone.
+	struct Matrix{
+		BigInt m[2][2] = {{1, 0}, {0, 1}};
+		bool odd = false, moved = false;
+		int first = 0;
+		//this = this * (a b; c d)
+		template<class T>
+		void mul(const T &a, const T &b, const T &c, const T &d, bool o){
+			for (int r = first; r < 2; r++){
+				BigInt t = m[r][0] * a + m[r][1] * c;
+				m[r][1] = m[r][0] * b + m[r][1] * d;
+				m[r][0] = move(t);
+			}
+			odd ^= o;
+			moved = true;
+		}
+		void mul(const Matrix &o){
+			mul(o.m[0][0], o.m[0][1], o.m[1][0], o.m[1][1], o.odd);
+		}
+		//this = this * (q 1; 1 0), one division step
+		void step(const BigInt &q){
+			for (int r = first; r < 2; r++){
+				BigInt t = m[r][0] * q + m[r][1];
+				m[r][1] = move(m[r][0]);
+				m[r][0] = move(t);
+			}
+			odd = !odd;
+			moved = true;
+		}
+		void swap_columns(){
+			for (int r = first; r < 2; r++)
+				m[r][0].limbs.swap(m[r][1].limbs);
+			odd = !odd;
+		}
+	};
+
+	//Whether a reduction may leave y with this many limbs: above s, or any
+	//size at all for s = 0
+	static bool keeps(const BigInt &y, size_t s){
+		return !s || y.limbs.size() > s;
+	}
+
+	//Bits sh to sh + 63 of v
+	static limb_t top_bits(const LimbStorage &v, size_t sh){
+		size_t i = sh / 64, n = v.size();
+		unsigned b = sh % 64;
+		limb_t lo = i < n ? v[i] >> b : 0;
+		if(b && i + 1 < n)
+			lo |= v[i + 1] << (64 - b);
+		return lo;
+	}
+	//(x; y) = (+-a +-b; +-c +-d) (x; y) in place over n limbs, with the signs
+	//fixed at compile time, for cofactors below 2^62 and results that are not
+	//negative and fit in n limbs
+	template<bool NA, bool NB, bool NC, bool ND>
+	static void limbs_lehmer(limb_t *x, limb_t *y, size_t n, limb_t a, limb_t b, limb_t c, limb_t d){
+		__int128 cx = 0, cy = 0;
+		for (size_t i = 0; i < n; i++){
+			__int128 pa = (dlimb_t)a * x[i], pb = (dlimb_t)b * y[i];
+			__int128 pc = (dlimb_t)c * x[i], pd = (dlimb_t)d * y[i];
+			cx += (NA ? -pa : pa) + (NB ? -pb : pb);
+			cy += (NC ? -pc : pc) + (ND ? -pd : pd);
+			x[i] = (limb_t)cx;
+			y[i] = (limb_t)cy;
+			cx >>= 64;
+			cy >>= 64;
+		}
+	}
+	//Applies (A B; C D) to x >= y, or with undo its inverse, which has the
+	//magnitudes (|D| |B|; |C| |A|) and no negative entry
+	static void apply(BigInt &x, BigInt &y, size_t n, int64_t A, int64_t B, int64_t C, int64_t D, bool odd, bool undo){
+		x.limbs.resize(n);
+		y.limbs.resize(n);
+		limb_t a = A < 0 ? -A : A, b = B < 0 ? -B : B, c = C < 0 ? -C : C, d = D < 0 ? -D : D;
+		if(undo)
+			limbs_lehmer<false, false, false, false>(x.limbs.data(), y.limbs.data(), n, d, b, c, a);
+		else if(odd)
+			limbs_lehmer<true, false, false, true>(x.limbs.data(), y.limbs.data(), n, a, b, c, d);
+		else
+			limbs_lehmer<false, true, true, false>(x.limbs.data(), y.limbs.data(), n, a, b, c, d);
+		limbs_trim(x.limbs);
+		limbs_trim(y.limbs);
+	}
+	//q = floor(n / d) for n, d > 0, by comparison when it is small as it
+	//mostly is
+	static uint64_t quotient(uint64_t n, uint64_t d){
+		if(n / 4 >= d)
+			return n / d;
+		uint64_t q = 0;
+		for (; n >= d; q++)
+			n -= d;
+		return q;
+	}
+
+	//Knuth's Algorithm L: runs Euclid on the top 62 bits of x and the same bits
+	//of y for as long as the quotients provably match those of the full pair,
+	//then applies the accumulated cofactors in one pass. Returns false when no
+	//quotient was found or y would fall to s limbs or fewer.
+	static bool lehmer_step(BigInt &x, BigInt &y, Matrix *M, size_t s){
+		size_t bits = bit_length(x);
+		if(bits <= 64)
+			return false;
+		size_t sh = bits - 62;
+		int64_t u = top_bits(x.limbs, sh), v = top_bits(y.limbs, sh);
+		int64_t A = 1, B = 0, C = 0, D = 1;
+		bool odd = false;
+		while(v + C > 0 && v + D > 0 && u + A >= 0 && u + B >= 0){
+			//The quotient must be the same at both ends of the interval
+			uint64_t q = quotient(u + A, v + C);
+			dlimb_t lo = (dlimb_t)q * (uint64_t)(v + D);
+			if(lo > (uint64_t)(u + B) || (uint64_t)(u + B) - lo >= (uint64_t)(v + D))
+				break;
+			int64_t t = A - (int64_t)q * C;
+			A = C;
+			C = t;
+			t = B - (int64_t)q * D;
+			B = D;
+			D = t;
+			t = u - (int64_t)q * v;
+			u = v;
+			v = t;
+			odd = !odd;
+		}
+		if(!B)
+			return false;
+		//A and D have the sign of (-1)^odd, B and C the other one
+		size_t n = x.limbs.size();
+		apply(x, y, n, A, B, C, D, odd, false);
+		if(!keeps(y, s)){
+			apply(x, y, n, A, B, C, D, odd, true);
+			return false;
+		}
+		//(A B; C D) has determinant (-1)^odd, so M gains (|D| |B|; |C| |A|)
+		if(M)
+			M->mul((limb_t)(D < 0 ? -D : D), (limb_t)(B < 0 ? -B : B), (limb_t)(C < 0 ? -C : C), (limb_t)(A < 0 ? -A : A), odd);
+		return true;
+	}
+	//x, y = y, x mod y, unless that leaves y with s limbs or fewer
+	static bool division_step(BigInt &x, BigInt &y, Matrix *M, size_t s){
+		BigInt q, r;
+		divmod(q, r, x, y);
+		if(!keeps(r, s))
+			return false;
+		x.limbs.swap(y.limbs);
+		y.limbs.swap(r.limbs);
+		if(M)
+			M->step(q);
+		return true;
+	}
+	static void reduce(BigInt &x, BigInt &y, Matrix *M, size_t s){
+		while(y.limbs.size() > s)
+			if(!lehmer_step(x, y, M, s) && !division_step(x, y, M, s))
+				return;
+	}
+
+	//Reduces x >= y by the matrix that half-gcd finds for their limbs from p
+	//up. Where that matrix is not the identity it leaves both parts above s1
+	//limbs with entries below B^(n1 - s1), so applying it to the low limbs
+	//moves each result by less than its top part, which keeps both positive.
+	static void hgcd_top(BigInt &x, BigInt &y, Matrix &M, size_t p){
+		BigInt xh = x >> 64 * p, yh = y >> 64 * p;
+		Matrix H;
+		hgcd(xh, yh, H);
+		if(!H.moved)
+			return;
+		BigInt xl, yl;
+		xl.limbs.assign(x.limbs.data(), min(p, x.limbs.size()));
+		yl.limbs.assign(y.limbs.data(), min(p, y.limbs.size()));
+		limbs_trim(xl.limbs);
+		limbs_trim(yl.limbs);
+		//(x'; y') = H^-1 (x; y), H^-1 = (-1)^odd (h11 -h01; -h10 h00)
+		BigInt dx = H.m[1][1] * xl - H.m[0][1] * yl, dy = H.m[0][0] * yl - H.m[1][0] * xl;
+		if(H.odd)
+			dx = -move(dx),
+			dy = -move(dy);
+		x = (xh << 64 * p) + dx;
+		y = (yh << 64 * p) + dy;
+		if(x < y){
+			x.limbs.swap(y.limbs);
+			H.swap_columns();
+		}
+		M.mul(H);
+	}
+	//Reduces x >= y of n limbs while both stay above s = n / 2 + 1 limbs:
+	//once from the top half of the limbs, then by division until the larger
+	//has about 3n / 4 limbs, and once more from its top 2 (n' - s) limbs
+	static void hgcd(BigInt &x, BigInt &y, Matrix &M){
+		size_t n = x.limbs.size(), s = n / 2 + 1;
+		if(y.limbs.size() <= s)
+			return;
+		if(n < max(BigIntTuning::hgcd_threshold, (size_t)8)){
+			reduce(x, y, &M, s);
+			return;
+		}
+		hgcd_top(x, y, M, n / 2);
+		while(y.limbs.size() > s && x.limbs.size() > (n + s) / 2 + 1)
+			if(!division_step(x, y, &M, s))
+				return;
+		if(y.limbs.size() > s)
+			hgcd_top(x, y, M, 2 * s - x.limbs.size());
+		reduce(x, y, &M, s);
+	}
+
+public:
+	//x = gcd(x, y) for x >= y >= 0, leaving y zero. With M it also keeps the
+	//second row of the matrix that takes the pair to (gcd; 0).
+	static void run(BigInt &x, BigInt &y, Matrix *M){
+		while(!Null(y)){
+			size_t n = x.limbs.size(), m = y.limbs.size();
+			if(!M && n <= 2){
+				dlimb_t a = x.limbs[0] | (n > 1 ? (dlimb_t)x.limbs[1] << 64 : 0);
+				dlimb_t b = y.limbs[0] | (m > 1 ? (dlimb_t)y.limbs[1] << 64 : 0);
+				dlimb_t g = m == 1 && n == 1 ? binary_gcd(x.limbs[0], y.limbs[0]) : binary_gcd(a, b);
+				limb_t w[2] = {(limb_t)g, (limb_t)(g >> 64)};
+				x.limbs.assign(w, 2);
+				limbs_trim(x.limbs);
+				y.limbs.clear();
+				return;
+			}
+			if(m >= BigIntTuning::hgcd_threshold && m > n / 2 + 1){
+				Matrix H;
+				hgcd(x, y, H);
+				if(M && H.moved)
+					M->mul(H);
+			}
+			//One step past where the half-gcd stopped, so every pass makes progress
+			if(!lehmer_step(x, y, M, 0))
+				division_step(x, y, M, 0);
+		}
+	}
+	static BigInt gcd(const BigInt &a, const BigInt &b){
+		BigInt x = abs(a), y = abs(b);
+		if(x < y)
+			x.limbs.swap(y.limbs);
+		run(x, y, nullptr);
+		return x;
+	}
+	//g = gcd(a, b) = sa + tb with |s| <= |b| / 2g and |t| <= |a| / 2g
+	static void xgcd(BigInt &g, BigInt &s, BigInt &t, const BigInt &a, const BigInt &b){
+		BigInt x = abs(a), y = abs(b);
+		bool swapped = x < y;
+		if(swapped)
+			x.limbs.swap(y.limbs);
+		BigInt x0 = x, y0 = y, sx;
+		if(Null(y))
+			sx = Null(x) ? 0 : 1;
+		else{
+			Matrix M;
+			M.first = 1;
+			run(x, y, &M);
+			//x0 = m00 g and y0 = m10 g, so g = (-1)^odd (m11 x0 - m01 y0) and the
+			//cofactor of x0 is determined modulo y0 / g; take the one nearest zero
+			sx = M.odd ? -M.m[1][1] : M.m[1][1];
+			const BigInt &period = M.m[1][0];
+			sx = floor_mod(sx, period);
+			if(sx + sx > period)
+				sx -= period;
+		}
+		g = move(x);
+		BigInt sy = Null(y0) ? BigInt() : divexact(g - sx * x0, y0);
+		if(swapped)
+			swap(sx, sy);
+		s = a.negative ? -move(sx) : move(sx);
+		t = b.negative ? -move(sy) : move(sy);
+	}
+};
+
+//Greatest common divisor of the magnitudes, gcd(0, 0) = 0
+inline BigInt gcd(const BigInt &a, const BigInt &b){
+	return BigIntGcd::gcd(a, b);
+}
+//Least common multiple of the magnitudes, zero when either is zero
+inline BigInt lcm(const BigInt &a, const BigInt &b){
+	if(Null(a) || Null(b))
+		return BigInt();
+	return abs(divexact(a, gcd(a, b)) * b);
+}
+//g = gcd(a, b) and the smallest cofactors with g = sa + tb: |s| <= |b| / 2g and
+//|t| <= |a| / 2g, except that a single nonzero operand gets cofactor +-1
+inline void xgcd(BigInt &g, BigInt &s, BigInt &t, const BigInt &a, const BigInt &b){
+	BigIntGcd::xgcd(g, s, t, a, b);
+}
+inline tuple<BigInt, BigInt, BigInt> xgcd(const BigInt &a, const BigInt &b){
+	tuple<BigInt, BigInt, BigInt> r;
+	xgcd(get<0>(r), get<1>(r), get<2>(r), a, b);
+	return r;
+}
+//x in [0, m) with ax = 1 modulo m > 0; throws when gcd(a, m) != 1
+inline BigInt modinv(const BigInt &a, const BigInt &m){
+	if(sign(m) <= 0)
+		throw("ERROR");
+	BigInt g, s, t;
+	xgcd(g, s, t, floor_mod(a, m), m);
+	if(g != 1)
+		throw("Arithmetic Error: Not Invertible");
+	return floor_mod(s, m);
+}
+
+
+//f0, f1 = F(n - 1), F(n) for n >= 1 by fast doubling over the bits of n. Each
+//step costs two squarings, from F(2k - 1) = F(k)^2 + F(k - 1)^2 and
+//F(2k + 1) = 4F(k)^2 - F(k - 1)^2 + 2(-1)^k, and F(2k) is their difference.
+inline void fibonacci_doubling(unsigned long long n, BigInt &f0, BigInt &f1){
+	BigInt a, b;
+	f0 = BigInt();
+	f1 = 1;
+	bool odd = true;
+	for (int i = 62 - __builtin_clzll(n); i >= 0; i--){
+		sqr(a, f1);
+		sqr(b, f0);
+		add(f0, a, b);
+		a <<= 2;
+		if(odd){
+			sub(f1, a, b);
+			f1 -= 2;
+		}
+		else{
+			a += 2;
+			sub(f1, a, b);
+		}
+		odd = n >> i & 1;
+		if(odd)
+			sub(f0, f1, f0);
+		else
+			sub(f1, f1, f0);
+	}
+}
+
+inline BigInt NthFibonacci(unsigned long long n){
+	if(!n)
+		return BigInt();
+	BigInt f0, f1;
+	fibonacci_doubling(n, f0, f1);
+	return f1;
+}
+//F(n) and F(n + 1)
+inline pair<BigInt, BigInt> NthFibonacciPair(unsigned long long n){
+	pair<BigInt, BigInt> res;
+	if(!n){
+		res.second = 1;
+		return res;
+	}
+	BigInt f0;
+	fibonacci_doubling(n, f0, res.first);
+	add(res.second, res.first, f0);
+	return res;
+}
+//L(n) = 2F(n + 1) - F(n)
+inline BigInt NthLucas(unsigned long long n){
+	pair<BigInt, BigInt> f = NthFibonacciPair(n);
+	f.second <<= 1;
+	sub(f.second, f.second, f.first);
+	return f.second;
+}
+//L(n) and L(n + 1) = 2F(n) + F(n + 1)
+inline pair<BigInt, BigInt> NthLucasPair(unsigned long long n){
+	pair<BigInt, BigInt> f = NthFibonacciPair(n), res;
+	res.first = f.second << 1;
+	sub(res.first, res.first, f.first);
+	res.second = f.first << 1;
+	add(res.second, res.second, f.second);
+	return res;
+}
+
+//Odd primes up to n, by a sieve over the odd numbers
+inline vector<limb_t> odd_primes_up_to(limb_t n){
+	vector<limb_t> primes;
+	if(n < 3)
+		return primes;
+	vector<bool> composite((n - 1) / 2);
+	for (limb_t i = 3; i <= n; i += 2){
+		if(composite[(i - 3) / 2])
+			continue;
+		primes.push_back(i);
+		for (limb_t j = i * i; j <= n && j >= i; j += 2 * i)
+			composite[(j - 3) / 2] = true;
+	}
+	return primes;
+}
+
+//Collects factors as limbs, multiplying neighbours together while they fit
+struct FactorList{
+	vector<limb_t> limbs;
+	limb_t acc = 1;
+	void push(limb_t f){
+		limb_t p;
+		if(__builtin_mul_overflow(acc, f, &p)){
+			limbs.push_back(acc);
+			acc = f;
+		}
+		else
+			acc = p;
+	}
+	vector<limb_t> &finish(){
+		if(acc > 1)
+			limbs.push_back(acc);
+		acc = 1;
+		return limbs;
+	}
+};
+
+//Product of f[0..n), pairing operands of similar size at every level so the
+//large products reach the subquadratic multiplications; with threads > 1 the
+//two halves are submitted to BigIntThreadPool, which runs them concurrently
+//once set_threads has given it the threads
+inline BigInt product_tree(const limb_t *f, size_t n, unsigned threads){
+	if(n <= 16){
+		BigInt r(1);
+		for (size_t i = 0; i < n; i++)
+			r *= f[i];
+		return r;
+	}
+	size_t h = n / 2;
+	BigInt left, right;
+	if(threads > 1)
+		BigIntThreadPool::invoke([&](){
+			left = product_tree(f, h, threads / 2);
+		}, [&](){
+			right = product_tree(f + h, n - h, threads - threads / 2);
+		});
+	else{
+		left = product_tree(f, h, 1);
+		right = product_tree(f + h, n - h, 1);
+	}
+	mul(left, left, right);
+	return left;
+}
+
+//Odd part of n!, via odd(n) = odd(n / 2)^2 * swing(n) where the swing
+//n! / (n / 2)!^2 holds each prime p as often as floor(n / p^i) is odd
+inline BigInt odd_factorial(limb_t n, const vector<limb_t> &primes, unsigned threads){
+	if(n < 3)
+		return BigInt(1);
+	BigInt r = odd_factorial(n / 2, primes, threads);
+	sqr(r, r);
+	FactorList f;
+	for (size_t i = 0; i < primes.size() && primes[i] <= n; i++)
+		for (limb_t q = n / primes[i]; q; q /= primes[i])
+			if(q & 1)
+				f.push(primes[i]);
+	vector<limb_t> &swing = f.finish();
+	mul(r, r, product_tree(swing.data(), swing.size(), threads));
+	return r;
+}
+
+//n! as its odd part shifted by the n - popcount(n) factors of two
+inline BigInt Factorial(unsigned long long n, unsigned threads){
+	BigInt r = odd_factorial(n, odd_primes_up_to(n), max(threads, 1u));
+	r <<= n - __builtin_popcountll(n);
+	return r;
+}
+inline BigInt Factorial(unsigned long long n){
+	return Factorial(n, 1);
+}
+
+//C(n, k). A binomial with few terms is the product of n - k + 1..n divided by
+//k!; otherwise it is assembled from its prime factorization, where p occurs
+//once per borrow when k and n - k are added in base p
+inline BigInt Binomial(unsigned long long n, unsigned long long k, unsigned threads){
+	if(k > n)
+		return BigInt();
+	k = min(k, n - k);
+	threads = max(threads, 1u);
+	FactorList f;
+	if(k <= n / 64){
+		for (limb_t j = 0; j < k; j++)
+			f.push(n - j);
+		vector<limb_t> &terms = f.finish();
+		return divexact(product_tree(terms.data(), terms.size(), threads), Factorial(k, threads));
+	}
+	size_t twos = 0;
+	for (limb_t a = n, b = k, c = n - k; a;){
+		a /= 2, b /= 2, c /= 2;
+		twos += a - b - c;
+	}
+	for (limb_t p : odd_primes_up_to(n))
+		for (limb_t a = n, b = k, c = n - k; a;){
+			a /= p, b /= p, c /= p;
+			if(a - b - c)
+				f.push(p);
+		}
+	vector<limb_t> &factors = f.finish();
+	BigInt r = product_tree(factors.data(), factors.size(), threads);
+	r <<= twos;
+	return r;
+}
+inline BigInt Binomial(unsigned long long n, unsigned long long k){
+	return Binomial(n, k, 1);
+}
+
+//C(n) = (2n)! / (n! (n + 1)!) assembled from its prime factorization without
+//any division: by Legendre's formula p occurs
+//sum floor(2n / p^i) - floor(n / p^i) - floor((n + 1) / p^i) times
+inline BigInt NthCatalan(unsigned long long n){
+	auto exponent = [n](limb_t p){
+		long long e = 0;
+		for (limb_t a = 2 * n, b = n, c = n + 1; a;){
+			a /= p, b /= p, c /= p;
+			e += (long long)a - b - c;
+		}
+		return e;
+	};
+	FactorList f;
+	for (limb_t p : odd_primes_up_to(2 * n))
+		for (long long e = exponent(p); e > 0; e--)
+			f.push(p);
+	vector<limb_t> &factors = f.finish();
+	BigInt r = product_tree(factors.data(), factors.size(), 1);
+	r <<= exponent(2);
+	return r;
+}
+
+//The Catalan numbers C(lo), ..., C(hi - 1) as an input range. Only C(lo) is
+//computed outright; each step applies C(n + 1) = C(n) * 2(2n + 1) / (n + 2)
+//with one single-limb multiplication and one exact single-limb division.
+class CatalanRange{
+	unsigned long long lo, hi;
+public:
+	class iterator{
+		unsigned long long n;
+		BigInt c;
+	public:
+		iterator(unsigned long long n, BigInt c) : n(n), c(move(c)){
+		}
+		const BigInt &operator*()const{
+			return c;
+		}
+		iterator &operator++(){
+			c *= 2 * (2 * n + 1);
+			divexact(c, c, n + 2);
+			n++;
+			return *this;
+		}
+		bool operator!=(const iterator &o)const{
+			return n != o.n;
+		}
+	};
+	CatalanRange(unsigned long long lo, unsigned long long hi) : lo(lo), hi(max(lo, hi)){
+	}
+	iterator begin()const{
+		return iterator(lo, lo < hi ? NthCatalan(lo) : BigInt());
+	}
+	iterator end()const{
+		return iterator(hi, BigInt());
+	}
+};
+
+//Reads one whitespace delimited number straight from the stream buffer
+inline istream &operator>>(istream &in,BigInt&a){
+	istream::sentry guard(in);
+	if(!guard)
+		return in;
+	streambuf *sb = in.rdbuf();
+	vector<char> s;
+	s.reserve(4096);
+	int c = sb->sgetc();
+	for (; c != EOF && !isspace(c); c = sb->snextc())
+		s.push_back(c);
+	if(c == EOF)
+		in.setstate(ios::eofbit);
+	if(s.empty()){
+		in.setstate(ios::failbit);
+		return in;
+	}
+	const char *p = s.data();
+	size_t n = s.size();
+	bool neg = decimal_skip_sign(p, n);
+	if(!n || decimal_prefix_length(p, n) != n)
+		throw("INVALID NUMBER");
+	a.limbs = decimal_to_limbs(p, n);
+	a.negative = neg && !a.limbs.empty();
+	return in;
+}
+
+//Parses an optional minus sign and the longest run of digits at first, like
+//std::from_chars. Works in place on any contiguous text such as a string_view
+//or a mapped file.
+inline from_chars_result from_chars(const char *first, const char *last, BigInt &a){
+	const char *p = first;
+	size_t n = last - first;
+	bool neg = decimal_skip_sign(p, n);
+	n = decimal_prefix_length(p, n);
+	if(!n)
+		return {first, errc::invalid_argument};
+	a.limbs = decimal_to_limbs(p, n);
+	a.negative = neg && !a.limbs.empty();
+	return {p + n, errc()};
+}
+
+inline ostream &operator<<(ostream &out,const BigInt &a){
+	string s = limbs_to_decimal(a.limbs);
+	if(a.negative)
+		out.put('-');
+	out.write(s.data(), s.size());
+	return out;
+}
+
+//Sign and decimal digits into [first, last) without a terminating zero, like
+//std::to_chars
+inline to_chars_result to_chars(char *first, char *last, const BigInt &a){
+	if(a.negative){
+		if(first == last)
+			return {last, errc::value_too_large};
+		*first++ = '-';
+	}
+	size_t bound = decimal_digits_bound(a.limbs.data(), a.limbs.size()), room = last - first;
+	if(room >= bound)
+		return {first + limbs_to_decimal(first, a.limbs.data(), a.limbs.size()), errc()};
+	string s = limbs_to_decimal(a.limbs);
+	if(s.size() > room)
+		return {last, errc::value_too_large};
+	memcpy(first, s.data(), s.size());
+	return {first + s.size(), errc()};
+}
+
+//Streams the sign and decimal digits to a file without building them all in
+//memory; returns the number of characters written
+inline size_t write_to(FILE *file, const BigInt &a){
+	return limbs_write_decimal(file, -1, a.limbs.data(), a.limbs.size(), a.negative);
+}
+inline size_t write_to(int fd, const BigInt &a){
+	return limbs_write_decimal(nullptr, fd, a.limbs.data(), a.limbs.size(), a.negative);
+}
+
+			/* * * * Binary serialization * * * */
+
+//A record is a 16 byte header, the magic "BINT", a version byte, a flags byte
+//whose bit 0 is the sign, two zero bytes and the limb count as a 64-bit word,
+//followed by the limbs from the least significant one. Every word is
+//little-endian, so on such hosts the limbs are copied or mapped as they are,
+//and a record starting 8-byte aligned keeps them aligned.
+inline const size_t BINARY_HEADER_BYTES = 16;
+inline const unsigned char BINARY_VERSION = 1;
+
+//Writes x as eight little-endian bytes
+inline void store_8_chars(char *s, uint64_t x){
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	x = __builtin_bswap64(x);
+#endif
+	memcpy(s, &x, 8);
+}
+
+inline void binary_write_header(char *h, size_t n, bool negative){
+	memcpy(h, "BINT", 4);
+	h[4] = BINARY_VERSION;
+	h[5] = negative;
+	h[6] = h[7] = 0;
+	store_8_chars(h + 8, n);
+}
+//Limb count of the header at h, with the sign in negative; throws unless the
+//header is one this version wrote
+inline size_t binary_read_header(const char *h, bool &negative){
+	if(memcmp(h, "BINT", 4) || h[4] != BINARY_VERSION || (h[5] & ~1) || h[6] || h[7])
+		throw("INVALID FORMAT");
+	negative = h[5];
+	return load_8_chars(h + 8);
+}
+//Throws unless a[0..n) with that sign is how a BigInt holds its value
+inline void binary_check_value(const limb_t *a, size_t n, bool negative){
+	if(n ? !a[n - 1] : negative)
+		throw("INVALID FORMAT");
+}
+
+inline void limbs_store_le(char *out, const limb_t *a, size_t n){
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	for (size_t i = 0; i < n; i++)
+		store_8_chars(out + 8 * i, a[i]);
+#else
+	memcpy(out, a, n * sizeof(limb_t));
+#endif
+}
+inline void limbs_load_le(limb_t *a, const char *in, size_t n){
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	for (size_t i = 0; i < n; i++)
+		a[i] = load_8_chars(in + 8 * i);
+#else
+	memcpy(a, in, n * sizeof(limb_t));
+#endif
+}
+
+//Bytes of the record serialize() writes for a
+inline size_t serialized_size(const BigInt &a){
+	return BINARY_HEADER_BYTES + a.limbs.size() * sizeof(limb_t);
+}
+//Writes the record of a to out, which must have room for serialized_size(a)
+//bytes; returns the number written
+inline size_t serialize(char *out, const BigInt &a){
+	size_t n = a.limbs.size();
+	binary_write_header(out, n, a.negative);
+	limbs_store_le(out + BINARY_HEADER_BYTES, a.limbs.data(), n);
+	return serialized_size(a);
+}
+inline string serialize(const BigInt &a){
+	string s(serialized_size(a), '\0');
+	serialize(&s[0], a);
+	return s;
+}
+inline ostream &serialize(ostream &out, const BigInt &a){
+	char h[BINARY_HEADER_BYTES];
+	size_t n = a.limbs.size();
+	binary_write_header(h, n, a.negative);
+	out.write(h, sizeof(h));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	char buf[8];
+	for (size_t i = 0; i < n && out; i++){
+		store_8_chars(buf, a.limbs[i]);
+		out.write(buf, 8);
+	}
+#else
+	out.write((const char *)a.limbs.data(), n * sizeof(limb_t));
+#endif
+	return out;
+}
+
+//Reads the record at p[0..size) into a; returns its length, so that records
+//stored back to back can be read in turn. Throws on a malformed or cut off
+//record, which leaves a as it was.
+inline size_t deserialize(const char *p, size_t size, BigInt &a){
+	if(size < BINARY_HEADER_BYTES)
+		throw("INVALID FORMAT");
+	bool neg;
+	size_t n = binary_read_header(p, neg);
+	if(n > (size - BINARY_HEADER_BYTES) / sizeof(limb_t))
+		throw("INVALID FORMAT");
+	LimbStorage v;
+	v.resize(n);
+	limbs_load_le(v.data(), p + BINARY_HEADER_BYTES, n);
+	binary_check_value(v.data(), n, neg);
+	a.limbs = move(v);
+	a.negative = neg;
+	return BINARY_HEADER_BYTES + n * sizeof(limb_t);
+}
+inline BigInt deserialize(const char *p, size_t size){
+	BigInt a;
+	deserialize(p, size, a);
+	return a;
+}
+//Like >>, sets failbit when the stream ends before a record starts; a record
+//cut off inside or malformed throws and leaves a as it was
+inline istream &deserialize(istream &in, BigInt &a){
+	char h[BINARY_HEADER_BYTES];
+	if(!in.read(h, 1))
+		return in;
+	if(!in.read(h + 1, sizeof(h) - 1))
+		throw("INVALID FORMAT");
+	bool neg;
+	size_t n = binary_read_header(h, neg);
+	//Grows with the data read, so a corrupt count cannot demand a huge buffer
+	const size_t block = 1 << 16;
+	vector<char> buf;
+	LimbStorage v;
+	for (size_t done = 0; done < n; ){
+		size_t k = min(n - done, block);
+		buf.resize(k * sizeof(limb_t));
+		if(!in.read(buf.data(), buf.size()))
+			throw("INVALID FORMAT");
+		v.resize(done + k);
+		limbs_load_le(v.data() + done, buf.data(), k);
+		done += k;
+	}
+	binary_check_value(v.data(), n, neg);
+	a.limbs = move(v);
+	a.negative = neg;
+	return in;
+}
+
+//Read-only value held in a serialized record, such as one in a mapped file.
+//It points into that memory, which must outlive it, and copies nothing; the
+//limbs can be passed to the limbs_* kernels as they are. Needs a little-endian
+//host and a record that starts 8-byte aligned.
+class BigIntView{
+	const limb_t *p = nullptr;
+	size_t n = 0;
+	bool neg = false;
+public:
+	BigIntView() = default;
+	//Checks the record at data[0..size) like deserialize() does
+	BigIntView(const void *data, size_t size){
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		throw("ERROR");
+#endif
+		const char *s = (const char *)data;
+		if(size < BINARY_HEADER_BYTES || (uintptr_t)s % alignof(limb_t))
+			throw("INVALID FORMAT");
+		n = binary_read_header(s, neg);
+		if(n > (size - BINARY_HEADER_BYTES) / sizeof(limb_t))
+			throw("INVALID FORMAT");
+		p = (const limb_t *)(s + BINARY_HEADER_BYTES);
+		binary_check_value(p, n, neg);
+	}
+
+	const limb_t *data()const{
+		return p;
+	}
+	size_t size()const{
+		return n;
+	}
+	bool negative()const{
+		return neg;
+	}
+	//Length of the record, the offset of the one after it
+	size_t bytes()const{
+		return BINARY_HEADER_BYTES + n * sizeof(limb_t);
+	}
+
+	explicit operator BigInt()const{
+		BigInt a;
+		a.limbs.assign(p, n);
+		a.negative = neg;
+		return a;
+	}
+	bool equals(const BigInt &a)const{
+		return neg == a.negative && !limbs_cmp(p, n, a.limbs.data(), a.limbs.size());
+	}
+	friend bool operator==(const BigIntView &v, const BigInt &a){
+		return v.equals(a);
+	}
+	friend bool operator==(const BigInt &a, const BigIntView &v){
+		return v.equals(a);
+	}
+	friend bool operator!=(const BigIntView &v, const BigInt &a){
+		return !v.equals(a);
+	}
+	friend bool operator!=(const BigInt &a, const BigIntView &v){
+		return !v.equals(a);
+	}
+	friend ostream &operator<<(ostream &out, const BigIntView &v){
+		string s = limbs_to_decimal(v);
+		if(v.neg)
+			out.put('-');
+		out.write(s.data(), s.size());
+		return out;
+	}
+};
+
+//Read-only mapping of a whole file of records, unmapped on destruction;
+//view(offset) reads the record at offset without copying it
+class BigIntMapping{
+	void *base = nullptr;
+	size_t len = 0;
+public:
+	//Throws "READ ERROR" when the file cannot be opened or mapped
+	explicit BigIntMapping(const char *path){
+		int fd = ::open(path, O_RDONLY);
+		if(fd < 0)
+			throw("READ ERROR");
+		struct stat st;
+		if(fstat(fd, &st)){
+			::close(fd);
+			throw("READ ERROR");
+		}
+		len = st.st_size;
+		if(len){
+			base = mmap(nullptr, len, PROT_READ, MAP_SHARED, fd, 0);
+			if(base == MAP_FAILED){
+				::close(fd);
+				throw("READ ERROR");
+			}
+		}
+		::close(fd);
+	}
+	BigIntMapping(BigIntMapping &&o) noexcept : base(exchange(o.base, nullptr)), len(exchange(o.len, 0)){
+	}
+	BigIntMapping &operator=(BigIntMapping &&o) noexcept{
+		swap(base, o.base);
+		swap(len, o.len);
+		return *this;
+	}
+	~BigIntMapping(){
+		if(base)
+			munmap(base, len);
+	}
+	BigIntMapping(const BigIntMapping &) = delete;
+	BigIntMapping &operator=(const BigIntMapping &) = delete;
+
+	const char *data()const{
+		return (const char *)base;
+	}
+	size_t size()const{
+		return len;
+	}
+	BigIntView view(size_t offset = 0)const{
+		if(offset > len)
+			throw("INVALID FORMAT");
+		return BigIntView(data() + offset, len - offset);
+	}
+};
+
+			/* * * * Lazy expressions * * * */
+
+//Opt-in expression templates. Wrapping the left factor in lazy() makes * return
+//an unevaluated product that is computed only once it is combined, so that
+//t = lazy(t) * 10 + d, a += lazy(b) * c and lazy(a) * b % m each fill a single
+//result buffer instead of materializing the product as a BigInt first.
+//The expressions hold references to their operands and must not outlive them.
+struct LazyBigInt{
+	const BigInt &v;
+};
+inline LazyBigInt lazy(const BigInt &a){
+	return {a};
+}
+
+//A signed scalar operand of a lazy expression, by magnitude and sign
+struct SignedLimb{
+	limb_t v;
+	bool negative;
+};
+template<class T, enable_if_signed_t<T> = 0>
+SignedLimb signed_limb(T n){
+	return {scalar_magnitude(n), n < 0};
+}
+
+//Limbs of an operand of a lazy expression, a BigInt or a single limb
+inline size_t operand_limbs(const BigInt &x, const limb_t *&p){
+	p = x.limbs.data();
+	return x.limbs.size();
+}
+inline size_t operand_limbs(const limb_t &x, const limb_t *&p){
+	p = &x;
+	return x != 0;
+}
+inline bool operand_negative(const BigInt &x){
+	return x.negative;
+}
+inline size_t operand_limbs(const SignedLimb &x, const limb_t *&p){
+	p = &x.v;
+	return x.v != 0;
+}
+inline bool operand_negative(const limb_t &){
+	return false;
+}
+inline bool operand_negative(const SignedLimb &x){
+	return x.negative;
+}
+//r += x for an addend of a lazy expression
+inline void operand_add(BigInt &r, const BigInt &x){
+	r += x;
+}
+inline void operand_add(BigInt &r, limb_t x){
+	r += x;
+}
+inline void operand_add(BigInt &r, const SignedLimb &x){
+	if(x.negative)
+		r -= x.v;
+	else
+		r += x.v;
+}
+
+//a * b, where b is a BigInt or a single limb
+template<class Rhs>
+struct BigIntProduct{
+	const BigInt &a;
+	Rhs b;
+	size_t size()const{
+		const limb_t *p;
+		return operand_limbs(a, p) + operand_limbs(b, p);
+	}
+	//r[0..size()) = a * b, r must not overlap either operand
+	void into(limb_t *r)const{
+		const limb_t *x, *y;
+		size_t n = operand_limbs(a, x), m = operand_limbs(b, y);
+		limbs_mul(r, x, n, y, m);
+	}
+	//Sign of the product, which into() leaves out
+	bool negative()const{
+		return operand_negative(a) != operand_negative(b);
+	}
+	operator BigInt()const{
+		BigInt r;
+		r.limbs.resize(size());
+		into(r.limbs.data());
+		limbs_trim(r.limbs);
+		r.negative = negative() && !r.limbs.empty();
+		return r;
+	}
+};
+
+//p + c, where c is a BigInt or a single limb; the sum is accumulated in the
+//buffer the product is written to when both have the same sign
+template<class Rhs, class Addend>
+struct BigIntMulAdd{
+	BigIntProduct<Rhs> p;
+	Addend c;
+	operator BigInt()const{
+		bool neg = p.negative();
+		BigInt r;
+		if(neg != operand_negative(c)){
+			r = p;
+			operand_add(r, c);
+			return r;
+		}
+		const limb_t *y;
+		size_t cn = operand_limbs(c, y), n = max(p.size(), cn);
+		r.limbs.resize(n + 1);
+		p.into(r.limbs.data());
+		r.limbs[n] = limbs_add(r.limbs.data(), r.limbs.data(), n, y, cn);
+		limbs_trim(r.limbs);
+		r.negative = neg && !r.limbs.empty();
+		return r;
+	}
+};
+
+inline BigIntProduct<const BigInt &> operator*(LazyBigInt a, const BigInt &b){
+	return {a.v, b};
+}
+inline BigIntProduct<limb_t> operator*(LazyBigInt a, unsigned long long b){
+	return {a.v, b};
+}
+template<class Rhs>
+BigIntMulAdd<Rhs, const BigInt &> operator+(const BigIntProduct<Rhs> &p, const BigInt &c){
+	return {p, c};
+}
+template<class Rhs>
+BigIntMulAdd<Rhs, const BigInt &> operator+(const BigInt &c, const BigIntProduct<Rhs> &p){
+	return {p, c};
+}
+template<class Rhs>
+BigIntMulAdd<Rhs, limb_t> operator+(const BigIntProduct<Rhs> &p, unsigned long long c){
+	return {p, c};
+}
+template<class Rhs>
+BigIntMulAdd<Rhs, limb_t> operator+(unsigned long long c, const BigIntProduct<Rhs> &p){
+	return {p, c};
+}
+template<class T, enable_if_signed_t<T> = 0>
+BigIntProduct<SignedLimb> operator*(LazyBigInt a, T b){
+	return {a.v, signed_limb(b)};
+}
+template<class Rhs, class T, enable_if_signed_t<T> = 0>
+BigIntMulAdd<Rhs, SignedLimb> operator+(const BigIntProduct<Rhs> &p, T c){
+	return {p, signed_limb(c)};
+}
+template<class Rhs, class T, enable_if_signed_t<T> = 0>
+BigIntMulAdd<Rhs, SignedLimb> operator+(T c, const BigIntProduct<Rhs> &p){
+	return {p, signed_limb(c)};
+}
+
+//Fused multiply-add: a small enough product is accumulated into a row by row.
+//A product of the opposite sign is a subtraction and goes through BigInt.
+template<class Rhs>
+BigInt &operator+=(BigInt &a, const BigIntProduct<Rhs> &p){
+	const limb_t *x, *y;
+	size_t n = operand_limbs(p.a, x), m = operand_limbs(p.b, y);
+	if(!n || !m)
+		return a;
+	if(p.negative() != a.negative && !a.limbs.empty())
+		return a += BigInt(p);
+	a.negative = p.negative();
+	if(n < m){
+		swap(x, y);
+		swap(n, m);
+	}
+	//When a is itself a factor its limbs can't be overwritten while they are read
+	bool aliased = x == a.limbs.data() || y == a.limbs.data();
+	if(m < BigIntTuning::karatsuba_threshold && !aliased){
+		size_t len = max(a.limbs.size(), n + m) + 1;
+		a.limbs.resize(len);
+		limb_t *r = a.limbs.data();
+		for (size_t j = 0; j < m; j++){
+			limb_t c = limbs_addmul_1(r + j, x, n, y[j]);
+			limbs_add(r + j + n, r + j + n, len - j - n, &c, 1);
+		}
+	}
+	else{
+		vector<limb_t> t(n + m);
+		limbs_mul(t.data(), x, n, y, m);
+		size_t len = max(a.limbs.size(), n + m) + 1;
+		a.limbs.resize(len);
+		limbs_add(a.limbs.data(), a.limbs.data(), len, t.data(), n + m);
+	}
+	limbs_trim(a.limbs);
+	return a;
+}
+
+//(a * b) mod m without a BigInt for the product, with the sign of the product
+template<class Rhs>
+BigInt operator%(const BigIntProduct<Rhs> &p, const BigInt &m){
+	size_t mn = m.limbs.size(), n = p.size();
+	if(!mn)
+		throw("Arithmetic Error: Division By 0");
+	vector<limb_t> t(n);
+	p.into(t.data());
+	n = limbs_normalized_size(t.data(), n);
+	BigInt r;
+	if(n < mn)
+		r.limbs.assign(t.data(), n);
+	else{
+		vector<limb_t> q(n - mn + 1);
+		r.limbs.resize(mn);
+		limbs_divrem(q.data(), r.limbs.data(), t.data(), n, m.limbs.data(), mn);
+		limbs_trim(r.limbs);
+	}
+	r.negative = p.negative() && !r.limbs.empty();
+	return r;
+}
+
+			/* * * * Modular arithmetic * * * */
+
+//Constants for arithmetic modulo a fixed m > 0, computed once. Odd moduli use
+//Montgomery multiplication and the others Barrett reduction; operands of any
+//size are reduced on entry and all results lie in [0, m).
+class ModContext{
+	BigInt mod;
+	vector<limb_t> m;
+	bool montgomery;
+	limb_t minv;
+	//Montgomery: 2^(128n) mod m in n limbs; Barrett: floor(2^(128n) / m)
+	vector<limb_t> r2, mu;
+
+	//Scratch space of one computation, so that a context can be shared
+	struct Workspace{
+		vector<limb_t> t, q, p, r;
+		Workspace(size_t n, size_t mun) : t(2 * n), q(n + 1 + mun), p(2 * n), r(n + 1){
+		}
+	};
+	Workspace workspace()const{
+		return Workspace(m.size(), mu.size());
+	}
+
+	//r[0..n) = t[0..2n) * 2^(-64n) mod m (Montgomery) or t mod m (Barrett);
+	//t < m^2 is overwritten
+	void reduce(limb_t *r, limb_t *t, Workspace &w)const{
+		size_t n = m.size();
+		if(montgomery){
+			limb_t carry = 0;
+			for (size_t i = 0; i < n; i++){
+				limb_t c = limbs_addmul_1(t + i, m.data(), n, t[i] * minv);
+				dlimb_t s = (dlimb_t)t[i + n] + c + carry;
+				t[i + n] = (limb_t)s;
+				carry = (limb_t)(s >> 64);
+			}
+			if(carry || limbs_cmp(t + n, n, m.data(), n) >= 0)
+				limbs_sub(r, t + n, n, m.data(), n);
+			else
+				copy(t + n, t + 2 * n, r);
+			return;
+		}
+		//The quotient estimate floor(floor(t / 2^(64(n-1))) * mu / 2^(64(n+1)))
+		//is at most two below t / m, and below m itself
+		limbs_mul(w.q.data(), t + n - 1, n + 1, mu.data(), mu.size());
+		limbs_mul(w.p.data(), w.q.data() + n + 1, n, m.data(), n);
+		limbs_sub(w.r.data(), t, n + 1, w.p.data(), n + 1);
+		while(w.r[n] || limbs_cmp(w.r.data(), n, m.data(), n) >= 0)
+			w.r[n] -= limbs_sub(w.r.data(), w.r.data(), n, m.data(), n);
+		copy(w.r.begin(), w.r.begin() + n, r);
+	}
+	//r = reduce(a * b), r may be a or b
+	void mul_reduce(limb_t *r, const limb_t *a, const limb_t *b, Workspace &w)const{
+		size_t n = m.size();
+		limbs_mul(w.t.data(), a, n, b, n);
+		reduce(r, w.t.data(), w);
+	}
+	//r[0..n) = a mod m in [0, m), in Montgomery form when that is in use
+	void to_form(limb_t *r, const BigInt &a, Workspace &w)const{
+		size_t n = m.size();
+		const BigInt &x = !a.negative && a < mod ? a : floor_mod(a, mod);
+		fill(r, r + n, 0);
+		copy(x.limbs.data(), x.limbs.data() + x.limbs.size(), r);
+		if(montgomery)
+			mul_reduce(r, r, r2.data(), w);
+	}
+	friend void mulmod_batch(BigIntBatch &, const BigIntBatch &, const BigIntBatch &, const ModContext &);
+
+	BigInt from_form(const limb_t *x, Workspace &w)const{
+		size_t n = m.size();
+		BigInt res;
+		res.limbs.resize(n);
+		if(montgomery){
+			fill(w.t.begin(), w.t.end(), 0);
+			copy(x, x + n, w.t.begin());
+			reduce(res.limbs.data(), w.t.data(), w);
+		}
+		else
+			copy(x, x + n, res.limbs.data());
+		limbs_trim(res.limbs);
+		return res;
+	}
+
+public:
+	explicit ModContext(const BigInt &modulus) : mod(modulus){
+		if(Null(mod))
+			throw("Arithmetic Error: Division By 0");
+		if(mod.negative)
+			throw("ERROR");
+		size_t n = mod.limbs.size();
+		m.assign(mod.limbs.data(), mod.limbs.data() + n);
+		montgomery = m[0] & 1;
+		BigInt power;
+		power.limbs.resize(2 * n + 1);
+		power.limbs[2 * n] = 1;
+		if(montgomery){
+			minv = -limb_inverse(m[0]);
+			power %= mod;
+			r2.assign(n, 0);
+			copy(power.limbs.data(), power.limbs.data() + power.limbs.size(), r2.begin());
+		}
+		else{
+			power /= mod;
+			mu.assign(power.limbs.data(), power.limbs.data() + power.limbs.size());
+		}
+	}
+	const BigInt &modulus()const{
+		return mod;
+	}
+
+	BigInt mulmod(const BigInt &a, const BigInt &b)const{
+		size_t n = m.size();
+		Workspace w = workspace();
+		vector<limb_t> x(n), y(n);
+		to_form(x.data(), a, w);
+		to_form(y.data(), b, w);
+		mul_reduce(x.data(), x.data(), y.data(), w);
+		return from_form(x.data(), w);
+	}
+	BigInt sqrmod(const BigInt &a)const{
+		size_t n = m.size();
+		Workspace w = workspace();
+		vector<limb_t> x(n);
+		to_form(x.data(), a, w);
+		mul_reduce(x.data(), x.data(), x.data(), w);
+		return from_form(x.data(), w);
+	}
+	//base^exp mod m by left-to-right sliding windows over the bits of exp >= 0
+	BigInt powmod(const BigInt &base, const BigInt &exp)const{
+		if(exp.negative)
+			throw("ERROR");
+		size_t n = m.size(), en = exp.limbs.size();
+		Workspace w = workspace();
+		vector<limb_t> x(n);
+		if(!en){
+			to_form(x.data(), BigInt(1), w);
+			return from_form(x.data(), w);
+		}
+		const limb_t *e = exp.limbs.data();
+		size_t bits = 64 * en - __builtin_clzll(e[en - 1]);
+		size_t k = bits <= 32 ? 1 : bits <= 128 ? 3 : bits <= 512 ? 4 : bits <= 1536 ? 5 : 6;
+		auto bit = [e](size_t i){
+			return (e[i / 64] >> (i % 64)) & 1;
+		};
+		//Odd powers base, base^3, ..., base^(2^k - 1)
+		vector<limb_t> g(n << (k - 1)), b2(n);
+		to_form(g.data(), base, w);
+		mul_reduce(b2.data(), g.data(), g.data(), w);
+		for (size_t i = 1; i < ((size_t)1 << (k - 1)); i++)
+			mul_reduce(&g[i * n], &g[(i - 1) * n], b2.data(), w);
+		bool started = false;
+		for (size_t i = bits; i--;){
+			if(!bit(i)){
+				mul_reduce(x.data(), x.data(), x.data(), w);
+				continue;
+			}
+			//Longest window of at most k bits ending in a one
+			size_t l = i + 1 >= k ? i + 1 - k : 0, v = 0;
+			while(!bit(l))
+				l++;
+			for (size_t j = i + 1; j-- > l;)
+				v = 2 * v + bit(j);
+			if(started){
+				for (size_t j = l; j <= i; j++)
+					mul_reduce(x.data(), x.data(), x.data(), w);
+				mul_reduce(x.data(), x.data(), &g[(v >> 1) * n], w);
+			}
+			else
+				copy(&g[(v >> 1) * n], &g[(v >> 1) * n] + n, x.data());
+			started = true;
+			i = l;
+		}
+		return from_form(x.data(), w);
+	}
+};
+
+inline BigInt powmod(const BigInt &base, const BigInt &exp, const BigInt &mod){
+	return ModContext(mod).powmod(base, exp);
+}
+
+			/* * * * Batch arithmetic * * * */
+
+//Values per block of a BigIntBatch
+inline const size_t LANES = 8;
+
+//W limbs side by side, as wide as the instruction set in use: 8 for AVX-512,
+//4 for AVX2 and 2 for SSE2 or NEON. Only ever a view of limb arrays, which
+//need not be aligned to its size.
+template<size_t W> struct LaneVector;
+template<> struct LaneVector<2>{
+	typedef limb_t type __attribute__((vector_size(16), aligned(8), may_alias));
+};
+template<> struct LaneVector<4>{
+	typedef limb_t type __attribute__((vector_size(32), aligned(8), may_alias));
+};
+template<> struct LaneVector<8>{
+	typedef limb_t type __attribute__((vector_size(64), aligned(8), may_alias));
+};
+
+class BigIntBatch{
+	size_t count = 0, width = 0;
+	vector<limb_t> limbs_;
+
+	//The limbs from row k of the batch on
+	limb_t *rows(size_t k){
+		return limbs_.data() + k * LANES;
+	}
+	const limb_t *rows(size_t k)const{
+		return limbs_.data() + k * LANES;
+	}
+
+	friend void add_batch(BigIntBatch &, const BigIntBatch &, const BigIntBatch &);
+	friend void mul_batch(BigIntBatch &, const BigIntBatch &, const BigIntBatch &);
+	friend void mulmod_batch(BigIntBatch &, const BigIntBatch &, const BigIntBatch &, const ModContext &);
+
+public:
+	BigIntBatch(){
+	}
+	BigIntBatch(size_t n, size_t limbs){
+		resize(n, limbs);
+	}
+	//Packs values, as wide as the widest of them
+	explicit BigIntBatch(const vector<BigInt> &values){
+		size_t limbs = 0;
+		for (const BigInt &x : values)
+			limbs = max(limbs, x.limbs.size());
+		resize(values.size(), limbs);
+		for (size_t i = 0; i < values.size(); i++)
+			set(i, values[i]);
+	}
+
+	size_t size()const{
+		return count;
+	}
+	size_t limbs()const{
+		return width;
+	}
+	size_t blocks()const{
+		return (count + LANES - 1) / LANES;
+	}
+	//Makes room for n values of the given width, all zero, reusing the storage
+	void resize(size_t n, size_t limbs){
+		count = n;
+		width = limbs;
+		limbs_.assign(blocks() * width * LANES, 0);
+	}
+
+	//Stores x, which must be non-negative and fit in the width
+	void set(size_t i, const BigInt &x){
+		size_t n = x.limbs.size();
+		if(i >= count || n > width || x.negative)
+			throw("ERROR");
+		limb_t *r = &limbs_[i / LANES * width * LANES + i % LANES];
+		for (size_t j = 0; j < width; j++)
+			r[j * LANES] = j < n ? x.limbs[j] : 0;
+	}
+	BigInt get(size_t i)const{
+		BigInt x;
+		get(i, x);
+		return x;
+	}
+	//Stores value i in x, reusing its buffer
+	void get(size_t i, BigInt &x)const{
+		if(i >= count)
+			throw("ERROR");
+		const limb_t *r = &limbs_[i / LANES * width * LANES + i % LANES];
+		size_t n = width;
+		while(n && !r[(n - 1) * LANES])
+			n--;
+		x.limbs.resize(n);
+		x.negative = false;
+		for (size_t j = 0; j < n; j++)
+			x.limbs[j] = r[j * LANES];
+	}
+	//Unpacks every value into out, reusing the buffers of its BigInts
+	void get(vector<BigInt> &out)const{
+		out.resize(count);
+		for (size_t i = 0; i < count; i++)
+			get(i, out[i]);
+	}
+};
+
+//Lane-wise kernels on whole blocks, W lanes of a block at a time. Row j of
+//the lanes at offset h of a block starts at limb j * LANES + h. Products are
+//formed from 32-bit digits, whose 64-bit products fit a lane: every partial
+//product is split into its low and high halves and summed into column
+//accumulators that cannot overflow, and the carries are resolved once per
+//column at the end.
+template<size_t W>
+struct LaneKernel{
+	typedef typename LaneVector<W>::type V;
+
+	static inline __attribute__((always_inline)) V &row(limb_t *p, size_t j){
+		return *(V *)(p + j * LANES);
+	}
+	static inline __attribute__((always_inline)) const V &row(const limb_t *p, size_t j){
+		return *(const V *)(p + j * LANES);
+	}
+	//d[0..2n) = the 32-bit digits of the rows x[0..n)
+	static inline __attribute__((always_inline)) void to_digits(V *d, const limb_t *x, size_t n){
+		const V low = V{} + 0xffffffff;
+		for (size_t i = 0; i < n; i++)
+			d[2 * i] = row(x, i) & low,
+			d[2 * i + 1] = row(x, i) >> 32;
+	}
+	//acc[i + j] += x[i] * y[j] for digit vectors x[0..nx) and y[0..ny); the
+	//masks tell the compiler these are 32 x 32 bit products (pmuludq)
+	static inline __attribute__((always_inline)) void mul_digits(V *acc, const V *x, size_t nx, const V *y, size_t ny){
+		const V low = V{} + 0xffffffff;
+		for (size_t i = 0; i < nx; i++)
+			for (size_t j = 0; j < ny; j++){
+				V p = (x[i] & low) * (y[j] & low);
+				acc[i + j] += p & low;
+				acc[i + j + 1] += p >> 32;
+			}
+	}
+
+	//r = a + b on blocks of ka, kb and max(ka, kb) + 1 rows
+	static inline __attribute__((always_inline)) void add(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+		size_t kr = max(ka, kb) + 1;
+		for (size_t blk = 0; blk < blocks; blk++)
+			for (size_t h = 0; h < LANES; h += W){
+				const limb_t *x = a + blk * ka * LANES + h, *y = b + blk * kb * LANES + h;
+				limb_t *z = r + blk * kr * LANES + h;
+				V c{};
+				for (size_t j = 0; j + 1 < kr; j++){
+					V u = j < ka ? row(x, j) : V{}, v = j < kb ? row(y, j) : V{};
+					V s = u + v, t = s + c;
+					c = (V)((s < u) | (t < s)) & 1;
+					row(z, j) = t;
+				}
+				row(z, kr - 1) = c;
+			}
+	}
+
+	//r = a * b on blocks of ka, kb and ka + kb rows
+	static inline __attribute__((always_inline)) void mul(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+		size_t na = 2 * ka, nb = 2 * kb, nr = na + nb;
+		vector<limb_t> scratch((na + nb + nr + 1) * W);
+		V *ad = (V *)scratch.data(), *bd = ad + na, *acc = bd + nb;
+		const V low = V{} + 0xffffffff;
+		for (size_t blk = 0; blk < blocks; blk++)
+			for (size_t h = 0; h < LANES; h += W){
+				limb_t *z = r + blk * (ka + kb) * LANES + h;
+				to_digits(ad, a + blk * ka * LANES + h, ka);
+				to_digits(bd, b + blk * kb * LANES + h, kb);
+				fill(acc, acc + nr + 1, V{});
+				mul_digits(acc, ad, na, bd, nb);
+				V c{};
+				for (size_t i = 0; i < nr; i += 2){
+					V lo = acc[i] + c;
+					V hi = acc[i + 1] + (lo >> 32);
+					c = hi >> 32;
+					row(z, i / 2) = (lo & low) | (hi << 32);
+				}
+			}
+	}
+
+	//Montgomery product r = x * y / 2^(64n) mod m on blocks of n rows, for
+	//lanes x, y < m and an odd m given as 2n rows of digits md, with
+	//minv = -1 / m mod 2^32. y advances by y_stride limbs per block, 0 for one
+	//shared y; r may be x.
+	static inline __attribute__((always_inline)) void montmul(limb_t *r, const limb_t *x, const limb_t *y, size_t y_stride,
+		const limb_t *md, limb_t minv, size_t n, size_t blocks){
+		size_t d = 2 * n;
+		vector<limb_t> scratch((5 * d + 1) * W);
+		V *xd = (V *)scratch.data(), *yd = xd + d, *acc = yd + d, *z = acc + 2 * d + 1;
+		const V low = V{} + 0xffffffff, mv = V{} + minv;
+		for (size_t blk = 0; blk < blocks; blk++)
+			for (size_t h = 0; h < LANES; h += W){
+				limb_t *out = r + blk * n * LANES + h;
+				to_digits(xd, x + blk * n * LANES + h, n);
+				to_digits(yd, y + blk * y_stride + h, n);
+				fill(acc, acc + 2 * d + 1, V{});
+				mul_digits(acc, xd, d, yd, d);
+				//Clear one digit per step by adding q * m, carrying the rest upwards
+				for (size_t i = 0; i < d; i++){
+					V q = ((acc[i] & low) * mv) & low;
+					for (size_t j = 0; j < d; j++){
+						V p = q * (row(md, j) & low);
+						acc[i + j] += p & low;
+						acc[i + j + 1] += p >> 32;
+					}
+					acc[i + 1] += acc[i] >> 32;
+				}
+				for (size_t i = d; i < 2 * d; i++)
+					z[i - d] = acc[i] & low,
+					acc[i + 1] += acc[i] >> 32;
+				//The sum is below 2m; subtract m where it is at least m
+				V borrow{}, *sd = xd;
+				for (size_t j = 0; j < d; j++){
+					V v = z[j] - row(md, j) - borrow;
+					sd[j] = v & low;
+					borrow = v >> 63;
+				}
+				V keep = (V)((acc[2 * d] == 0) & (borrow != 0));
+				for (size_t j = 0; j < d; j += 2)
+					row(out, j / 2) = ((z[j] | (z[j + 1] << 32)) & keep) | ((sd[j] | (sd[j + 1] << 32)) & ~keep);
+			}
+	}
+};
+
+inline void lanes_add_generic(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+	LaneKernel<2>::add(r, a, ka, b, kb, blocks);
+}
+inline void lanes_mul_generic(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+	LaneKernel<2>::mul(r, a, ka, b, kb, blocks);
+}
+inline void lanes_montmul_generic(limb_t *r, const limb_t *x, const limb_t *y, size_t y_stride, const limb_t *md, limb_t minv, size_t n, size_t blocks){
+	LaneKernel<2>::montmul(r, x, y, y_stride, md, minv, n, blocks);
+}
+#if defined(__x86_64__)
+__attribute__((target("avx2")))
+inline void lanes_add_avx2(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+	LaneKernel<4>::add(r, a, ka, b, kb, blocks);
+}
+__attribute__((target("avx2")))
+inline void lanes_mul_avx2(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+	LaneKernel<4>::mul(r, a, ka, b, kb, blocks);
+}
+__attribute__((target("avx2")))
+inline void lanes_montmul_avx2(limb_t *r, const limb_t *x, const limb_t *y, size_t y_stride, const limb_t *md, limb_t minv, size_t n, size_t blocks){
+	LaneKernel<4>::montmul(r, x, y, y_stride, md, minv, n, blocks);
+}
+__attribute__((target("avx512f")))
+inline void lanes_add_avx512(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+	LaneKernel<8>::add(r, a, ka, b, kb, blocks);
+}
+__attribute__((target("avx512f")))
+inline void lanes_mul_avx512(limb_t *r, const limb_t *a, size_t ka, const limb_t *b, size_t kb, size_t blocks){
+	LaneKernel<8>::mul(r, a, ka, b, kb, blocks);
+}
+__attribute__((target("avx512f")))
+inline void lanes_montmul_avx512(limb_t *r, const limb_t *x, const limb_t *y, size_t y_stride, const limb_t *md, limb_t minv, size_t n, size_t blocks){
+	LaneKernel<8>::montmul(r, x, y, y_stride, md, minv, n, blocks);
+}
+#endif
+
+struct LaneKernels{
+	const char *name;
+	void (*add)(limb_t *, const limb_t *, size_t, const limb_t *, size_t, size_t);
+	void (*mul)(limb_t *, const limb_t *, size_t, const limb_t *, size_t, size_t);
+	void (*montmul)(limb_t *, const limb_t *, const limb_t *, size_t, const limb_t *, limb_t, size_t, size_t);
+};
+
+inline LaneKernels select_lane_kernels(){
+#if defined(__x86_64__)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512f"))
+		return {"avx512", lanes_add_avx512, lanes_mul_avx512, lanes_montmul_avx512};
+	if(__builtin_cpu_supports("avx2"))
+		return {"avx2", lanes_add_avx2, lanes_mul_avx2, lanes_montmul_avx2};
+#endif
+	return {"generic", lanes_add_generic, lanes_mul_generic, lanes_montmul_generic};
+}
+
+inline const LaneKernels LANE_KERNELS = select_lane_kernels();
+
+//Blocks handed to one task of the pool
+inline const size_t BATCH_GRAIN = 64;
+//Widest operands for the lane kernels; with their 32-bit digits they do four
+//times the work of the scalar kernels, which win lane by lane beyond this
+inline const size_t BATCH_LANE_LIMBS = 4;
+
+//out[i] = a[i] + b[i]
+inline void add_batch(BigIntBatch &out, const BigIntBatch &a, const BigIntBatch &b){
+	if(a.count != b.count)
+		throw("ERROR");
+	size_t ka = a.width, kb = b.width, kr = max(ka, kb) + 1;
+	BigIntBatch tmp;
+	BigIntBatch &r = &out == &a || &out == &b ? tmp : out;
+	r.resize(a.count, kr);
+	BigIntThreadPool::parallel_for(r.blocks(), BATCH_GRAIN, [&](size_t lo, size_t hi){
+		LANE_KERNELS.add(r.rows(lo * kr), a.rows(lo * ka), ka, b.rows(lo * kb), kb, hi - lo);
+	});
+	if(&r == &tmp)
+		out = move(tmp);
+}
+
+//out[i] = a[i] * b[i]
+inline void mul_batch(BigIntBatch &out, const BigIntBatch &a, const BigIntBatch &b){
+	if(a.count != b.count)
+		throw("ERROR");
+	size_t ka = a.width, kb = b.width, kr = ka + kb;
+	BigIntBatch tmp;
+	BigIntBatch &r = &out == &a || &out == &b ? tmp : out;
+	r.resize(a.count, kr);
+	if(ka && kb && max(ka, kb) <= BATCH_LANE_LIMBS)
+		BigIntThreadPool::parallel_for(r.blocks(), BATCH_GRAIN, [&](size_t lo, size_t hi){
+			LANE_KERNELS.mul(r.rows(lo * kr), a.rows(lo * ka), ka, b.rows(lo * kb), kb, hi - lo);
+		});
+	else if(ka && kb)
+		BigIntThreadPool::parallel_for(r.blocks(), BATCH_GRAIN, [&](size_t lo, size_t hi){
+			vector<limb_t> u(ka), v(kb), t(kr);
+			for (size_t blk = lo; blk < hi; blk++)
+				for (size_t l = 0; l < LANES; l++){
+					for (size_t j = 0; j < ka; j++)
+						u[j] = a.limbs_[(blk * ka + j) * LANES + l];
+					for (size_t j = 0; j < kb; j++)
+						v[j] = b.limbs_[(blk * kb + j) * LANES + l];
+					limbs_mul(t.data(), u.data(), ka, v.data(), kb);
+					for (size_t j = 0; j < kr; j++)
+						r.limbs_[(blk * kr + j) * LANES + l] = t[j];
+				}
+		});
+	if(&r == &tmp)
+		out = move(tmp);
+}
+
+//out[i] = a[i] * b[i] mod m. Small odd moduli run two lane-wise Montgomery
+//products, by a[i] * b[i] and then by 2^(128n) mod m; the others go through
+//the ModContext lane by lane.
+inline void mulmod_batch(BigIntBatch &out, const BigIntBatch &a, const BigIntBatch &b, const ModContext &mod){
+	if(a.count != b.count)
+		throw("ERROR");
+	size_t n = mod.m.size();
+	//Whether value i of x, of at least n limbs, is m or more
+	auto too_big = [&](const BigIntBatch &x, size_t i){
+		const limb_t *l = &x.limbs_[i / LANES * x.width * LANES + i % LANES];
+		for (size_t j = x.width; j-- > n; )
+			if(l[j * LANES])
+				return true;
+		for (size_t j = n; j--; )
+			if(l[j * LANES] != mod.m[j])
+				return l[j * LANES] > mod.m[j];
+		return true;
+	};
+	//x itself when its values are n-limb lanes below m, else a copy made so in
+	//store; only the values that are not go through a BigInt
+	auto reduced = [&](const BigIntBatch &x, BigIntBatch &store) -> const BigIntBatch &{
+		bool fits = x.width == n;
+		for (size_t i = 0; fits && i < x.count; i++)
+			fits = !too_big(x, i);
+		if(fits)
+			return x;
+		store.resize(x.count, n);
+		size_t k = min(n, x.width);
+		for (size_t blk = 0; blk < x.blocks(); blk++)
+			copy(x.rows(blk * x.width), x.rows(blk * x.width + k), store.rows(blk * n));
+		BigInt v;
+		for (size_t i = 0; x.width >= n && i < x.count; i++)
+			if(too_big(x, i)){
+				x.get(i, v);
+				store.set(i, v % mod.mod);
+			}
+		return store;
+	};
+	BigIntBatch xs, ys, tmp;
+	const BigIntBatch &x = reduced(a, xs), &y = reduced(b, ys);
+	BigIntBatch &r = &out == &a || &out == &b ? tmp : out;
+	r.resize(a.count, n);
+	if(mod.montgomery && n <= BATCH_LANE_LIMBS){
+		//The digits of m and the limbs of r2 repeated in every lane
+		vector<limb_t> md(2 * n * LANES), r2(n * LANES);
+		for (size_t i = 0; i < 2 * n * LANES; i++)
+			md[i] = (mod.m[i / LANES / 2] >> (i / LANES % 2 * 32)) & 0xffffffff;
+		for (size_t i = 0; i < n * LANES; i++)
+			r2[i] = mod.r2[i / LANES];
+		limb_t minv = mod.minv & 0xffffffff;
+		BigIntThreadPool::parallel_for(r.blocks(), BATCH_GRAIN, [&](size_t lo, size_t hi){
+			limb_t *t = r.rows(lo * n);
+			LANE_KERNELS.montmul(t, x.rows(lo * n), y.rows(lo * n), n * LANES, md.data(), minv, n, hi - lo);
+			LANE_KERNELS.montmul(t, t, r2.data(), 0, md.data(), minv, n, hi - lo);
+		});
+	}
+	else
+		BigIntThreadPool::parallel_for(r.blocks(), BATCH_GRAIN, [&](size_t lo, size_t hi){
+			ModContext::Workspace w = mod.workspace();
+			vector<limb_t> u(n), v(n), q(n + 1);
+			for (size_t blk = lo; blk < hi; blk++)
+				for (size_t l = 0; l < LANES; l++){
+					size_t at = blk * n * LANES + l;
+					for (size_t j = 0; j < n; j++)
+						u[j] = x.limbs_[at + j * LANES],
+						v[j] = y.limbs_[at + j * LANES];
+					//Barrett reduces the product directly, Montgomery would need a second product
+					if(mod.montgomery){
+						limbs_mul(w.t.data(), u.data(), n, v.data(), n);
+						limbs_divrem(q.data(), u.data(), w.t.data(), 2 * n, mod.m.data(), n);
+					}
+					else
+						mod.mul_reduce(u.data(), u.data(), v.data(), w);
+					for (size_t j = 0; j < n; j++)
+						r.limbs_[at + j * LANES] = u[j];
+				}
+		});
+	if(&r == &tmp)
+		out = move(tmp);
+}
+
+//The same on vectors of BigInt, reusing the buffers already in out
+inline void add_batch(vector<BigInt> &out, const vector<BigInt> &a, const vector<BigInt> &b){
+	BigIntBatch r;
+	add_batch(r, BigIntBatch(a), BigIntBatch(b));
+	r.get(out);
+}
+inline void mul_batch(vector<BigInt> &out, const vector<BigInt> &a, const vector<BigInt> &b){
+	BigIntBatch r;
+	mul_batch(r, BigIntBatch(a), BigIntBatch(b));
+	r.get(out);
+}
+inline void mulmod_batch(vector<BigInt> &out, const vector<BigInt> &a, const vector<BigInt> &b, const ModContext &mod){
+	BigIntBatch r;
+	mulmod_batch(r, BigIntBatch(a), BigIntBatch(b), mod);
+	r.get(out);
+}
+
+			/* * * * Fixed-width integers * * * */
+
+//Unsigned integers of exactly Bits bits, a multiple of 64, with the wrap-around
+//arithmetic of the built-in unsigned types. The limbs are a std::array, so a
+//value never allocates and every loop has a trip count known at compile time;
+//all arithmetic is constexpr, so constants can be computed by the compiler:
+//	constexpr FixedBigInt<256> p("115792089237316195423570985008687907853269984665640564039457584007908834671663");
+template<size_t Bits>
+class FixedBigInt{
+	static_assert(Bits && Bits % 64 == 0, "FixedBigInt needs a positive multiple of 64 bits");
+public:
+	static constexpr size_t LIMBS = Bits / 64;
+
+private:
+	//Little-endian, all LIMBS limbs significant
+	array<limb_t, LIMBS> limbs;
+
+	//Columns [0, hi) of a * b into r[0..hi) by Comba's method: each column is
+	//summed in three registers and stored once, with no carry written back.
+	//The trip counts are constants, so small sizes unroll completely.
+	template<size_t N>
+	static constexpr void comba(limb_t *r, const array<limb_t, N> &a, const array<limb_t, N> &b, size_t hi){
+		dlimb_t acc = 0;
+		limb_t top = 0;
+#pragma GCC unroll 32
+		for (size_t k = 0; k < hi; k++){
+#pragma GCC unroll 32
+			for (size_t i = k < N ? 0 : k - N + 1; i <= k && i < N; i++){
+				dlimb_t p = (dlimb_t)a[i] * b[k - i];
+				acc += p;
+				top += acc < p;
+			}
+			r[k] = (limb_t)acc;
+			acc = acc >> 64 | (dlimb_t)top << 64;
+			top = 0;
+		}
+	}
+	//*this = *this * m + a, returns the limb shifted out
+	constexpr limb_t mul_add_1(limb_t m, limb_t a){
+		for (size_t i = 0; i < LIMBS; i++){
+			dlimb_t p = (dlimb_t)limbs[i] * m + a;
+			limbs[i] = (limb_t)p;
+			a = (limb_t)(p >> 64);
+		}
+		return a;
+	}
+	//*this /= d, returns the remainder
+	constexpr limb_t divrem_1(limb_t d){
+		limb_t r = 0;
+		for (size_t i = LIMBS; i--;){
+			dlimb_t u = (dlimb_t)r << 64 | limbs[i];
+			limbs[i] = (limb_t)(u / d);
+			r = (limb_t)(u % d);
+		}
+		return r;
+	}
+
+	template<size_t> friend class FixedBigInt;
+
+public:
+	constexpr FixedBigInt(unsigned long long n = 0) : limbs{n}{
+	}
+	//From little-endian limbs
+	explicit constexpr FixedBigInt(const array<limb_t, LIMBS> &l) : limbs(l){
+	}
+	//Zero extends or keeps the low Bits, like a conversion between unsigned types
+	template<size_t B>
+	explicit constexpr FixedBigInt(const FixedBigInt<B> &a) : limbs{}{
+		for (size_t i = 0; i < LIMBS && i < a.LIMBS; i++)
+			limbs[i] = a.limbs[i];
+	}
+	//Decimal digits; throws on any other character or a value of more than Bits bits
+	explicit constexpr FixedBigInt(string_view s) : limbs{}{
+		if(s.empty())
+			throw("ERROR");
+		for (char c : s){
+			if(c < '0' || c > '9')
+				throw("INVALID NUMBER");
+			if(mul_add_1(10, c - '0'))
+				throw("OVERFLOW");
+		}
+	}
+	explicit constexpr FixedBigInt(const char *s) : FixedBigInt(string_view(s)){
+	}
+	//Throws unless 0 <= a < 2^Bits
+	explicit FixedBigInt(const BigInt &a) : limbs{}{
+		size_t n = a.limbs.size();
+		if(a.negative || n > LIMBS)
+			throw("ERROR");
+		copy(a.limbs.data(), a.limbs.data() + n, limbs.begin());
+	}
+	explicit operator BigInt()const{
+		BigInt r;
+		r.limbs.assign(limbs.data(), limbs_normalized_size(limbs.data(), LIMBS));
+		return r;
+	}
+
+	constexpr limb_t limb(size_t i)const{
+		return limbs[i];
+	}
+
+	constexpr FixedBigInt &operator+=(const FixedBigInt &b){
+		limb_t c = 0;
+		for (size_t i = 0; i < LIMBS; i++){
+			dlimb_t s = (dlimb_t)limbs[i] + b.limbs[i] + c;
+			limbs[i] = (limb_t)s;
+			c = (limb_t)(s >> 64);
+		}
+		return *this;
+	}
+	constexpr FixedBigInt &operator-=(const FixedBigInt &b){
+		limb_t c = 0;
+		for (size_t i = 0; i < LIMBS; i++){
+			dlimb_t d = (dlimb_t)limbs[i] - b.limbs[i] - c;
+			limbs[i] = (limb_t)d;
+			c = (limb_t)(d >> 64) & 1;
+		}
+		return *this;
+	}
+	constexpr FixedBigInt &operator*=(const FixedBigInt &b){
+		return *this = *this * b;
+	}
+	constexpr FixedBigInt &operator++(){
+		for (size_t i = 0; i < LIMBS && !++limbs[i]; i++)
+			;
+		return *this;
+	}
+	constexpr FixedBigInt &operator--(){
+		for (size_t i = 0; i < LIMBS && !limbs[i]--; i++)
+			;
+		return *this;
+	}
+
+	friend constexpr FixedBigInt operator+(FixedBigInt a, const FixedBigInt &b){
+		return a += b;
+	}
+	friend constexpr FixedBigInt operator-(FixedBigInt a, const FixedBigInt &b){
+		return a -= b;
+	}
+	//The low Bits of the product; the columns above them are never formed
+	friend constexpr FixedBigInt operator*(const FixedBigInt &a, const FixedBigInt &b){
+		FixedBigInt r;
+		comba(r.limbs.data(), a.limbs, b.limbs, LIMBS);
+		return r;
+	}
+	//The full product in twice the bits
+	friend constexpr FixedBigInt<2 * Bits> mul_wide(const FixedBigInt &a, const FixedBigInt &b){
+		array<limb_t, 2 * LIMBS> r{};
+		comba(r.data(), a.limbs, b.limbs, 2 * LIMBS);
+		return FixedBigInt<2 * Bits>(r);
+	}
+
+	//Single limb divisors
+	constexpr FixedBigInt &operator/=(unsigned long long d){
+		if(!d)
+			throw("Arithmetic Error: Division By 0");
+		divrem_1(d);
+		return *this;
+	}
+	friend constexpr FixedBigInt operator/(FixedBigInt a, unsigned long long d){
+		return a /= d;
+	}
+	friend constexpr unsigned long long operator%(FixedBigInt a, unsigned long long d){
+		if(!d)
+			throw("Arithmetic Error: Division By 0");
+		return a.divrem_1(d);
+	}
+
+	constexpr FixedBigInt &operator<<=(size_t s){
+		size_t k = s / 64, b = s % 64;
+		for (size_t i = LIMBS; i--;){
+			limb_t hi = i >= k ? limbs[i - k] : 0, lo = i > k ? limbs[i - k - 1] : 0;
+			limbs[i] = b ? hi << b | lo >> (64 - b) : hi;
+		}
+		return *this;
+	}
+	constexpr FixedBigInt &operator>>=(size_t s){
+		size_t k = s / 64, b = s % 64;
+		for (size_t i = 0; i < LIMBS; i++){
+			limb_t lo = i + k < LIMBS ? limbs[i + k] : 0, hi = i + k + 1 < LIMBS ? limbs[i + k + 1] : 0;
+			limbs[i] = b ? lo >> b | hi << (64 - b) : lo;
+		}
+		return *this;
+	}
+	friend constexpr FixedBigInt operator<<(FixedBigInt a, size_t s){
+		return a <<= s;
+	}
+	friend constexpr FixedBigInt operator>>(FixedBigInt a, size_t s){
+		return a >>= s;
+	}
+	friend constexpr FixedBigInt operator&(FixedBigInt a, const FixedBigInt &b){
+		for (size_t i = 0; i < LIMBS; i++)
+			a.limbs[i] &= b.limbs[i];
+		return a;
+	}
+	friend constexpr FixedBigInt operator|(FixedBigInt a, const FixedBigInt &b){
+		for (size_t i = 0; i < LIMBS; i++)
+			a.limbs[i] |= b.limbs[i];
+		return a;
+	}
+	friend constexpr FixedBigInt operator^(FixedBigInt a, const FixedBigInt &b){
+		for (size_t i = 0; i < LIMBS; i++)
+			a.limbs[i] ^= b.limbs[i];
+		return a;
+	}
+	friend constexpr FixedBigInt operator~(FixedBigInt a){
+		for (size_t i = 0; i < LIMBS; i++)
+			a.limbs[i] = ~a.limbs[i];
+		return a;
+	}
+
+	friend constexpr bool operator==(const FixedBigInt &a, const FixedBigInt &b){
+		for (size_t i = 0; i < LIMBS; i++)
+			if(a.limbs[i] != b.limbs[i])
+				return false;
+		return true;
+	}
+	friend constexpr bool operator!=(const FixedBigInt &a, const FixedBigInt &b){
+		return !(a == b);
+	}
+	friend constexpr bool operator<(const FixedBigInt &a, const FixedBigInt &b){
+		for (size_t i = LIMBS; i--;)
+			if(a.limbs[i] != b.limbs[i])
+				return a.limbs[i] < b.limbs[i];
+		return false;
+	}
+	friend constexpr bool operator>(const FixedBigInt &a, const FixedBigInt &b){
+		return b < a;
+	}
+	friend constexpr bool operator<=(const FixedBigInt &a, const FixedBigInt &b){
+		return !(b < a);
+	}
+	friend constexpr bool operator>=(const FixedBigInt &a, const FixedBigInt &b){
+		return !(a < b);
+	}
+
+	friend ostream &operator<<(ostream &out, const FixedBigInt &a){
+		return out << BigInt(a);
+	}
+};
+
+} //namespace bigint
+
+#endif
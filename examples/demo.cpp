@@ -0,0 +1,373 @@
+//Examples of the BigInt API and the built-in timing reports: run with no
+//arguments for the examples, or with "bench" for the reports
+#include "bigint.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace std;
+using namespace bigint;
+
+			/* * * * Benchmarks * * * */
+
+typedef void (*MulTier)(limb_t *, const limb_t *, size_t, const limb_t *, size_t);
+
+//Times one top-level multiplication tier on n x n limb operands, in microseconds;
+//a squaring run passes the same operand twice
+static double time_mul_tier(MulTier tier, size_t n, bool square = false){
+	mt19937_64 rng(n);
+	vector<limb_t> a(n), b(n), r(2 * n);
+	for (size_t i = 0; i < n; i++)
+		a[i] = rng(),
+		b[i] = rng();
+	int reps = 0;
+	auto start = chrono::steady_clock::now();
+	chrono::duration<double, micro> elapsed;
+	do{
+		tier(r.data(), a.data(), n, square ? a.data() : b.data(), n);
+		reps++;
+		elapsed = chrono::steady_clock::now() - start;
+	} while(elapsed.count() < 20000);
+	return elapsed.count() / reps;
+}
+
+//Reports the multiplication and squaring thresholds and the time of every tier
+void BenchmarkMultiplication(ostream &out){
+	MulTier sqr_basecase = [](limb_t *r, const limb_t *a, size_t n, const limb_t *, size_t){
+		limbs_sqr_basecase(r, a, n);
+	};
+	MulTier sqr_karatsuba = [](limb_t *r, const limb_t *a, size_t n, const limb_t *, size_t){
+		limbs_sqr_karatsuba(r, a, n);
+	};
+	out << "karatsuba_threshold = " << BigIntTuning::karatsuba_threshold << " limbs\n"
+		<< "toom3_threshold = " << BigIntTuning::toom3_threshold << " limbs\n"
+		<< "ntt_threshold = " << BigIntTuning::ntt_threshold << " limbs\n"
+		<< setw(8) << "limbs" << setw(16) << "schoolbook us" << setw(16) << "karatsuba us"
+		<< setw(16) << "toom3 us" << setw(16) << "ntt us" << '\n';
+	for (size_t n = 8; n <= 16384; n *= 2){
+		out << setw(8) << n << fixed << setprecision(2)
+			<< setw(16) << time_mul_tier(limbs_mul_basecase, n)
+			<< setw(16) << time_mul_tier(limbs_mul_karatsuba, n)
+			<< setw(16) << time_mul_tier(limbs_mul_toom3, n)
+			<< setw(16) << time_mul_tier(limbs_mul_ntt, n) << '\n';
+	}
+	out << "karatsuba_sqr_threshold = " << BigIntTuning::karatsuba_sqr_threshold << " limbs\n"
+		<< "toom3_sqr_threshold = " << BigIntTuning::toom3_sqr_threshold << " limbs\n"
+		<< "ntt_sqr_threshold = " << BigIntTuning::ntt_sqr_threshold << " limbs\n"
+		<< setw(8) << "limbs" << setw(16) << "schoolbook us" << setw(16) << "karatsuba us"
+		<< setw(16) << "toom3 us" << setw(16) << "ntt us" << '\n';
+	for (size_t n = 8; n <= 16384; n *= 2){
+		out << setw(8) << n << fixed << setprecision(2)
+			<< setw(16) << time_mul_tier(sqr_basecase, n, true)
+			<< setw(16) << time_mul_tier(sqr_karatsuba, n, true)
+			<< setw(16) << time_mul_tier(limbs_mul_toom3, n, true)
+			<< setw(16) << time_mul_tier(limbs_mul_ntt, n, true) << '\n';
+	}
+}
+
+//Times a 2n / n limb division with the given recursive division threshold
+static double time_divide(size_t n, size_t bz_threshold){
+	mt19937_64 rng(n);
+	vector<limb_t> a(2 * n), b(n), q(n + 1), r(n);
+	for (size_t i = 0; i < n; i++)
+		a[i] = rng(),
+		a[n + i] = rng(),
+		b[i] = rng();
+	size_t saved = BigIntTuning::divide_bz_threshold;
+	BigIntTuning::divide_bz_threshold = bz_threshold;
+	int reps = 0;
+	auto start = chrono::steady_clock::now();
+	chrono::duration<double, micro> elapsed;
+	do{
+		limbs_divrem(q.data(), r.data(), a.data(), 2 * n, b.data(), n);
+		reps++;
+		elapsed = chrono::steady_clock::now() - start;
+	} while(elapsed.count() < 20000);
+	BigIntTuning::divide_bz_threshold = saved;
+	return elapsed.count() / reps;
+}
+
+//Reports the division threshold and times Knuth's and the recursive division
+void BenchmarkDivision(ostream &out){
+	out << "divide_bz_threshold = " << BigIntTuning::divide_bz_threshold << " limbs\n"
+		<< setw(8) << "limbs" << setw(16) << "knuth us" << setw(16) << "recursive us" << '\n';
+	for (size_t n = 8; n <= 16384; n *= 2)
+		out << setw(8) << n << fixed << setprecision(2)
+			<< setw(16) << time_divide(n, SIZE_MAX)
+			<< setw(16) << time_divide(n, BigIntTuning::divide_bz_threshold) << '\n';
+}
+
+//Times computing the Catalan numbers 0..n on each of threads threads, in milliseconds;
+//their limbs come from the heap, from a fresh arena per number or from a per-thread pool
+enum class AllocMode{ heap, arena, pool };
+static double time_catalan_table(int n, unsigned threads, AllocMode mode){
+	auto work = [n, mode](){
+		pmr::unsynchronized_pool_resource pool;
+		for (int i = 0; i <= n; i++){
+			if(mode == AllocMode::arena){
+				BigIntArena scope;
+				NthCatalan(i);
+			}
+			else if(mode == AllocMode::pool){
+				BigIntArena scope(&pool);
+				NthCatalan(i);
+			}
+			else
+				NthCatalan(i);
+		}
+	};
+	auto start = chrono::steady_clock::now();
+	vector<thread> workers;
+	for (unsigned t = 0; t < threads; t++)
+		workers.emplace_back(work);
+	for (thread &t : workers)
+		t.join();
+	return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+//Compares the limb allocators on a Catalan table computed by every hardware thread at once
+void BenchmarkAllocation(ostream &out){
+	unsigned threads = max(1u, thread::hardware_concurrency());
+	out << "catalan table threads = " << threads << '\n'
+		<< setw(8) << "n" << setw(16) << "heap ms" << setw(16) << "arena ms" << setw(16) << "pool ms" << '\n';
+	for (int n = 100; n <= 800; n *= 2)
+		out << setw(8) << n << fixed << setprecision(2)
+			<< setw(16) << time_catalan_table(n, threads, AllocMode::heap)
+			<< setw(16) << time_catalan_table(n, threads, AllocMode::arena)
+			<< setw(16) << time_catalan_table(n, threads, AllocMode::pool) << '\n';
+}
+
+//Times an n x n limb product on the pool with the given number of threads, in milliseconds
+static double time_parallel_mul(size_t n, unsigned threads){
+	mt19937_64 rng(n);
+	vector<limb_t> a(n), b(n), r(2 * n);
+	for (size_t i = 0; i < n; i++)
+		a[i] = rng(),
+		b[i] = rng();
+	unsigned saved = BigIntThreadPool::threads();
+	BigIntThreadPool::set_threads(threads);
+	auto start = chrono::steady_clock::now();
+	limbs_mul(r.data(), a.data(), n, b.data(), n);
+	double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+	BigIntThreadPool::set_threads(saved);
+	return ms;
+}
+
+//Compares serial and pooled multiplication on every hardware thread
+void BenchmarkParallel(ostream &out){
+	unsigned threads = max(1u, thread::hardware_concurrency());
+	out << "parallel_threshold = " << BigIntTuning::parallel_threshold << " limbs, pool threads = " << threads << '\n'
+		<< setw(8) << "limbs" << setw(16) << "serial ms" << setw(16) << "pool ms" << '\n';
+	for (size_t n = 1 << 12; n <= 1 << 20; n *= 4)
+		out << setw(8) << n << fixed << setprecision(2)
+			<< setw(16) << time_parallel_mul(n, 1)
+			<< setw(16) << time_parallel_mul(n, threads) << '\n';
+}
+
+//Times one of the equal length kernels of k on n limbs, in nanoseconds per limb
+enum class KernelOp{ add, sub, cmp };
+static double time_kernel(const LimbKernels &k, KernelOp op, size_t n){
+	mt19937_64 rng(n);
+	vector<limb_t> a(n), b(n), r(n);
+	for (size_t i = 0; i < n; i++)
+		a[i] = rng(),
+		b[i] = a[i];
+	b[0]++;
+	volatile limb_t sink = 0;
+	long reps = 0;
+	auto start = chrono::steady_clock::now();
+	chrono::duration<double, nano> elapsed;
+	do{
+		for (int i = 0; i < 64; i++)
+			if(op == KernelOp::add)
+				sink = k.add_n(r.data(), a.data(), b.data(), n, 0);
+			else if(op == KernelOp::sub)
+				sink = k.sub_n(r.data(), a.data(), b.data(), n, 0);
+			else
+				sink = k.cmp_n(a.data(), b.data(), n);
+		reps += 64;
+		elapsed = chrono::steady_clock::now() - start;
+	} while(elapsed.count() < 2e7);
+	(void)sink;
+	return elapsed.count() / reps / n;
+}
+
+//Times add, subtract and compare for every kernel set this CPU supports
+void BenchmarkKernels(ostream &out){
+	out << "limb kernels = " << LIMB_KERNELS.name << '\n'
+		<< setw(8) << "limbs" << setw(10) << "kernels" << setw(16) << "add ns/limb"
+		<< setw(16) << "sub ns/limb" << setw(16) << "cmp ns/limb" << '\n';
+	for (size_t n = 16; n <= 4096; n *= 4)
+		for (const LimbKernels &k : available_limb_kernels())
+			out << setw(8) << n << setw(10) << k.name << fixed << setprecision(3)
+				<< setw(16) << time_kernel(k, KernelOp::add, n)
+				<< setw(16) << time_kernel(k, KernelOp::sub, n)
+				<< setw(16) << time_kernel(k, KernelOp::cmp, n) << '\n';
+}
+
+//Times a * b % m over count random values of n limbs, one operator at a time
+//and as one mulmod_batch, in nanoseconds per value
+static pair<double, double> time_mulmod_batch(size_t n, size_t count){
+	mt19937_64 rng(n);
+	auto random = [&](){
+		BigInt x;
+		for (size_t i = 0; i < n; i++)
+			x = (x << 64) + BigInt(rng());
+		return x;
+	};
+	BigInt m = random() | BigInt(1);
+	ModContext mod(m);
+	vector<BigInt> a(count), b(count), out(count);
+	for (size_t i = 0; i < count; i++)
+		a[i] = random() % m,
+		b[i] = random() % m;
+	BigIntBatch x(a), y(b), r;
+	auto start = chrono::steady_clock::now();
+	for (size_t i = 0; i < count; i++)
+		out[i] = a[i] * b[i] % m;
+	auto middle = chrono::steady_clock::now();
+	mulmod_batch(r, x, y, mod);
+	auto end = chrono::steady_clock::now();
+	return {chrono::duration<double, nano>(middle - start).count() / count,
+		chrono::duration<double, nano>(end - middle).count() / count};
+}
+
+//Compares a * b % m through the operators with mulmod_batch
+void BenchmarkBatch(ostream &out){
+	out << "lane kernels = " << LANE_KERNELS.name << '\n'
+		<< setw(8) << "limbs" << setw(16) << "operators ns" << setw(16) << "batch ns" << '\n';
+	for (size_t n = 1; n <= 16; n *= 2){
+		pair<double, double> t = time_mulmod_batch(n, 1 << 16);
+		out << setw(8) << n << fixed << setprecision(1) << setw(16) << t.first << setw(16) << t.second << '\n';
+	}
+}
+
+//Times the full product of two Bits-bit values as BigInt and as FixedBigInt,
+//in nanoseconds per product
+template<size_t Bits>
+static pair<double, double> time_fixed_mul(){
+	mt19937_64 rng(Bits);
+	const size_t count = 64, reps = (1 << 22) / Bits;
+	vector<FixedBigInt<Bits>> fa(count), fb(count);
+	vector<BigInt> ba(count), bb(count);
+	for (size_t i = 0; i < count; i++){
+		array<limb_t, Bits / 64> x, y;
+		for (size_t j = 0; j < Bits / 64; j++)
+			x[j] = rng(),
+			y[j] = rng();
+		fa[i] = FixedBigInt<Bits>(x);
+		fb[i] = FixedBigInt<Bits>(y);
+		ba[i] = BigInt(fa[i]);
+		bb[i] = BigInt(fb[i]);
+	}
+	limb_t sink = 0;
+	BigInt r;
+	auto start = chrono::steady_clock::now();
+	for (size_t k = 0; k < reps; k++)
+		for (size_t i = 0; i < count; i++){
+			mul(r, ba[i], bb[(i + k) % count]);
+			sink ^= test_bit(r, k % Bits);
+		}
+	auto middle = chrono::steady_clock::now();
+	for (size_t k = 0; k < reps; k++)
+		for (size_t i = 0; i < count; i++)
+			sink ^= mul_wide(fa[i], fb[(i + k) % count]).limb(k % (Bits / 32));
+	auto end = chrono::steady_clock::now();
+	if(sink == 42)
+		cerr << "";
+	return {chrono::duration<double, nano>(middle - start).count() / (reps * count),
+		chrono::duration<double, nano>(end - middle).count() / (reps * count)};
+}
+
+//Compares BigInt and FixedBigInt multiplication at the usual key sizes
+void BenchmarkFixed(ostream &out){
+	out << setw(8) << "bits" << setw(16) << "BigInt ns" << setw(16) << "fixed ns" << '\n';
+	pair<double, double> t[] = {time_fixed_mul<256>(), time_fixed_mul<512>(), time_fixed_mul<1024>(), time_fixed_mul<4096>()};
+	size_t bits[] = {256, 512, 1024, 4096};
+	for (size_t i = 0; i < 4; i++)
+		out << setw(8) << bits[i] << fixed << setprecision(1) << setw(16) << t[i].first << setw(16) << t[i].second << '\n';
+}
+
+//Driver code with some examples
+int main(int argc, char **argv)
+{
+	if(argc > 1 && !strcmp(argv[1], "bench")){
+		BenchmarkMultiplication(cout);
+		BenchmarkDivision(cout);
+		BenchmarkAllocation(cout);
+		BenchmarkKernels(cout);
+		BenchmarkParallel(cout);
+		BenchmarkBatch(cout);
+		BenchmarkFixed(cout);
+#ifdef BIGINT_STATS
+		BigIntStats::snapshot().dump(cout);
+#endif
+		return 0;
+	}
+	BigInt first("12345");
+	cout << "The number of digits"
+		<< " in first big integer = "
+		<< Length(first) << '\n';
+	BigInt second(12345);
+	if (first == second) {
+		cout << "first and second are equal!\n";
+	}
+	else
+		cout << "Not equal!\n";
+	BigInt third("10000");
+	BigInt fourth("100000");
+	if (third < fourth) {
+		cout << "third is smaller than fourth!\n";
+	}
+	BigInt fifth("10000000");
+	if (fifth > fourth) {
+		cout << "fifth is larger than fourth!\n";
+	}
+
+	// Printing all the numbers
+	cout << "first = " << first << '\n';
+	cout << "second = " << second << '\n';
+	cout << "third = " << third << '\n';
+	cout << "fourth = " << fourth<< '\n';
+	cout << "fifth = " << fifth<< '\n';
+
+	// Incrementing the value of first
+	first++;
+	cout << "After incrementing the"
+		<< " value of first is : ";
+	cout << first << '\n';
+	BigInt sum;
+	sum = (fourth + fifth);
+	cout << "Sum of fourth and fifth = "
+		<< sum << '\n';
+	BigInt product;
+	product = second * third;
+	cout << "Product of second and third = "
+		<< product << '\n';
+
+	// Print the fibonacci number from 1 to 100
+	cout << "-------------------------Fibonacci"
+		<< "------------------------------\n";
+	for (int i = 0; i <= 100; i++) {
+		BigInt Fib;
+		Fib = NthFibonacci(i);
+		cout << "Fibonacci " << i << " = " << Fib<<'\n';
+	}
+	cout << "-------------------------Catalan"
+		<< "------------------------------\n";
+	int i = 0;
+	for (const BigInt &Cat : CatalanRange(0, 101))
+		cout << "Catalan " << i++ << " = " << Cat << '\n';
+
+	cout << "Factorial"<< "\n";
+	for (int i = 0; i <= 100; i++) {
+		BigInt fact;
+		fact = Factorial(i);
+		cout << "Factorial of "
+			<< i << " = ";
+		cout << fact << '\n';
+	}
+}
@@ -0,0 +1,286 @@
+//Regression checks for the public API: each CHECK compares the decimal form
+//of an expression with the expected text, and the run fails on any mismatch
+#include "bigint.hpp"
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+using namespace bigint;
+
+static int failures = 0;
+
+template<class T>
+static void check(const T &value, const char *expected, const char *expr, int line){
+	ostringstream out;
+	out << value;
+	if(out.str() != expected){
+		cerr << "line " << line << ": " << expr << " = " << out.str() << ", expected " << expected << '\n';
+		failures++;
+	}
+}
+#define CHECK(expr, expected) check(BigInt(expr), expected, #expr, __LINE__)
+
+//Runs the statement and checks that it throws error
+#define CHECK_THROWS(stmt, error) \
+	do{ \
+		const char *thrown = "nothing"; \
+		try{ \
+			stmt; \
+		} \
+		catch(const char *e){ \
+			thrown = e; \
+		} \
+		if(strcmp(thrown, error)) \
+			check(thrown, error, #stmt, __LINE__); \
+	} while(0)
+
+//Negative built-in operands must not convert to unsigned long long
+static void test_signed_scalars(){
+	BigInt x(5), y(-7);
+	CHECK(x * -3, "-15");
+	CHECK(x + -1, "4");
+	CHECK(x - -2, "7");
+	CHECK(y / -2, "3");
+	CHECK(y % -2, "-1");
+	CHECK(BigInt(7) % -2, "1");
+	CHECK(-3 * x, "-15");
+	CHECK(-3 + x, "2");
+	CHECK(x * LLONG_MIN, "-46116860184273879040");
+	CHECK(x * (short)-2, "-10");
+	CHECK(BigInt(x) * -2, "-10");
+	CHECK(divexact(BigInt(-12), -4), "3");
+
+	BigInt z = x;
+	z *= -1;
+	CHECK(z, "-5");
+	z += -4;
+	CHECK(z, "-9");
+	z -= -10;
+	CHECK(z, "1");
+	z /= -1;
+	CHECK(z, "-1");
+	z %= -2;
+	CHECK(z, "-1");
+
+	CHECK(lazy(x) * -2 + 1, "-9");
+	CHECK(1 + lazy(x) * -2, "-9");
+	CHECK(lazy(y) * -2 + -1, "13");
+	CHECK(lazy(y) * -3 % BigInt(4), "1");
+	BigInt w = 10;
+	w += lazy(x) * -3;
+	CHECK(w, "-5");
+}
+
+static void test_binomial(){
+	CHECK(Binomial(~0ULL, 1), "18446744073709551615");
+	CHECK(Binomial(~0ULL, 2), "170141183460469231704017187605319778305");
+	CHECK(Binomial(~0ULL, ~0ULL), "1");
+	CHECK(Binomial(100, 50), "100891344545564193334812497256");
+}
+
+//Product trees split across the pool give the serial result
+static void test_parallel_factorial(){
+	BigInt serial = Factorial(20000);
+	BigIntThreadPool::set_threads(4);
+	BigInt parallel = Factorial(20000, 4), binomial = Binomial(100000, 1000, 4);
+	BigIntThreadPool::set_threads(1);
+	check(parallel == serial, "1", "Factorial(20000, 4) == Factorial(20000)", __LINE__);
+	check(binomial == Binomial(100000, 1000), "1", "Binomial(100000, 1000, 4) == Binomial(100000, 1000)", __LINE__);
+}
+
+//The basecase printer keeps every digit above 66 limbs, where a limb holds
+//more than 19 digits on average
+static void test_decimal_basecase(){
+	BigInt x = (BigInt(1) << (64 * 150)) - 1;
+	ostringstream dc, basecase;
+	dc << x;
+	size_t threshold = BigIntTuning::decimal_dc_threshold;
+	BigIntTuning::decimal_dc_threshold = 1000;
+	basecase << x;
+	BigIntTuning::decimal_dc_threshold = threshold;
+	check(dc.str().size(), "2890", "digits of 2^9600 - 1", __LINE__);
+	check(basecase.str() == dc.str(), "1", "basecase digits of 2^9600 - 1", __LINE__);
+	check(BigInt(dc.str()) == x, "1", "BigInt(str(2^9600 - 1)) == 2^9600 - 1", __LINE__);
+}
+
+//Values of 0, 1 and 2 limbs and a large one, each with both signs
+static vector<BigInt> serialization_values(){
+	vector<BigInt> values;
+	for (const BigInt &x : {BigInt(), BigInt(1), BigInt(~0ULL), BigInt(1) << 64,
+			(BigInt(3) << 130) + 7, pow(BigInt(7), BigInt(5000ULL))}){
+		values.push_back(x);
+		if(!Null(x))
+			values.push_back(-x);
+	}
+	return values;
+}
+
+//Every form of serialize() reads back as the same value
+static void test_serialize_round_trip(){
+	vector<BigInt> values = serialization_values();
+	string all;
+	ostringstream stream;
+	for (const BigInt &x : values){
+		string s = serialize(x);
+		check(s.size() == serialized_size(x), "1", "serialized_size(x)", __LINE__);
+		BigInt y = 9;
+		check(deserialize(s.data(), s.size(), y) == s.size() && y == x, "1", "deserialize(serialize(x))", __LINE__);
+		check(deserialize(s.data(), s.size()) == x, "1", "deserialize(s, n)", __LINE__);
+		BigIntView v(s.data(), s.size());
+		check(v == x && !(v != x) && BigInt(v) == x && v.bytes() == s.size(), "1", "BigIntView(serialize(x))", __LINE__);
+		all += s;
+		serialize(stream, x);
+	}
+	check(stream.str() == all, "1", "serialize(ostream &, x)", __LINE__);
+
+	//Records stored back to back, read from memory, a stream and a mapped file
+	size_t offset = 0;
+	for (const BigInt &x : values){
+		BigInt y;
+		offset += deserialize(all.data() + offset, all.size() - offset, y);
+		check(y == x, "1", "deserialize at offset", __LINE__);
+	}
+	check(offset, to_string(all.size()).c_str(), "bytes consumed", __LINE__);
+
+	istringstream in(all);
+	BigInt y;
+	size_t count = 0;
+	while(deserialize(in, y)){
+		check(y == values[count], "1", "deserialize(istream &, y)", __LINE__);
+		count++;
+	}
+	check(count, to_string(values.size()).c_str(), "records read from a stream", __LINE__);
+
+	const char *path = "bigint_test_records.bin";
+	ofstream(path, ios::binary) << all;
+	{
+		BigIntMapping map(path);
+		check(map.size(), to_string(all.size()).c_str(), "BigIntMapping::size()", __LINE__);
+		size_t at = 0;
+		for (const BigInt &x : values){
+			BigIntView v = map.view(at);
+			check(v == x, "1", "BigIntMapping::view(at)", __LINE__);
+			at += v.bytes();
+		}
+		CHECK_THROWS(map.view(all.size() + 1), "INVALID FORMAT");
+		CHECK_THROWS(map.view(all.size()), "INVALID FORMAT");
+	}
+	remove(path);
+	CHECK_THROWS(BigIntMapping("bigint_test_missing.bin"), "READ ERROR");
+}
+
+//Malformed records throw "INVALID FORMAT" from every reader
+static void test_serialize_malformed(){
+	string s = serialize(-((BigInt(3) << 130) + 7));
+	string zero_top = s, bad_magic = s, bad_version = s, bad_flags = s, negative_zero = serialize(BigInt());
+	memset(&zero_top[zero_top.size() - 8], 0, 8);
+	bad_magic[0] = 'X';
+	bad_version[4]++;
+	bad_flags[5] |= 2;
+	negative_zero[5] = 1;
+	for (const string &r : {zero_top, bad_magic, bad_version, bad_flags, negative_zero,
+			s.substr(0, s.size() - 1), s.substr(0, 20), s.substr(0, 15)}){
+		BigInt a = 42;
+		CHECK_THROWS(deserialize(r.data(), r.size(), a), "INVALID FORMAT");
+		CHECK(a, "42");
+		istringstream in(r);
+		CHECK_THROWS(deserialize(in, a), "INVALID FORMAT");
+		CHECK(a, "42");
+		CHECK_THROWS(BigIntView(r.data(), r.size()), "INVALID FORMAT");
+	}
+	//A clean end of stream sets failbit and keeps the target
+	BigInt a = 42;
+	istringstream empty("");
+	check(!deserialize(empty, a) && empty.fail(), "1", "deserialize at end of stream", __LINE__);
+	CHECK(a, "42");
+}
+
+//A record that fails to load throws and leaves the target as it was
+static void test_deserialize_failure(){
+	BigInt x = (BigInt(3) << 130) + 7, a = -5;
+	string s = serialize(x);
+	string zero_top = s;
+	memset(&zero_top[zero_top.size() - 8], 0, 8);
+	CHECK_THROWS(deserialize(zero_top.data(), zero_top.size(), a), "INVALID FORMAT");
+	CHECK(a, "-5");
+	check(sign(a), "-1", "sign(a)", __LINE__);
+
+	istringstream bad(zero_top);
+	CHECK_THROWS(deserialize(bad, a), "INVALID FORMAT");
+	CHECK(a, "-5");
+	istringstream cut(s.substr(0, s.size() - 3));
+	CHECK_THROWS(deserialize(cut, a), "INVALID FORMAT");
+	CHECK(a, "-5");
+	check(a == BigInt(-5), "1", "a == BigInt(-5)", __LINE__);
+}
+
+//Malformed tokens throw "INVALID NUMBER" from >>, and from_chars reports
+//them without consuming anything
+static void test_parse_errors(){
+	for (const char *token : {"-", "12a", "--1", "-x", "1-"}){
+		BigInt a = 9;
+		istringstream in(token);
+		const char *thrown = "nothing";
+		try{
+			in >> a;
+		}
+		catch(const char *e){
+			thrown = e;
+		}
+		check(thrown, "INVALID NUMBER", token, __LINE__);
+		CHECK(a, "9");
+	}
+	for (const char *token : {"-", "", "-x", "x"}){
+		BigInt a = 9;
+		from_chars_result r = from_chars(token, token + strlen(token), a);
+		check(r.ec == errc::invalid_argument && r.ptr == token, "1", token, __LINE__);
+		CHECK(a, "9");
+	}
+	BigInt a;
+	istringstream in("-12 -0 7");
+	in >> a;
+	CHECK(a, "-12");
+	in >> a;
+	CHECK(a, "0");
+	in >> a;
+	CHECK(a, "7");
+}
+
+//Length() and operator[] agree with the printed digits around powers of ten
+static void test_digits(){
+	BigInt ten = 1;
+	for (int k = 0; k < 400; k++, ten *= 10)
+		for (const BigInt &x : {ten - 1, ten, ten + 1, -ten}){
+			ostringstream out;
+			out << abs(x);
+			string s = out.str();
+			if(Length(x) != (int)s.size())
+				check(Length(x), to_string(s.size()).c_str(), "Length(x)", __LINE__);
+			for (int i : {0, (int)s.size() / 2, (int)s.size() - 1})
+				if(x[i] != s[s.size() - 1 - i] - '0')
+					check(x[i], string(1, s[s.size() - 1 - i]).c_str(), "x[i]", __LINE__);
+			CHECK_THROWS(x[(int)s.size()], "ERROR");
+		}
+	check(Length(BigInt()), "1", "Length(0)", __LINE__);
+	CHECK_THROWS(BigInt(5)[-1], "ERROR");
+}
+
+int main(){
+	test_signed_scalars();
+	test_binomial();
+	test_parallel_factorial();
+	test_decimal_basecase();
+	test_deserialize_failure();
+	test_serialize_round_trip();
+	test_serialize_malformed();
+	test_parse_errors();
+	test_digits();
+	if(failures)
+		cerr << failures << " checks failed\n";
+	return failures != 0;
+}